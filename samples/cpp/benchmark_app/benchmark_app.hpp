@@ -73,6 +73,29 @@ static const char maximum_inference_rate_message[] =
     "If not specified, default value is 0, the inference will run at maximum rate depending on a device capabilities. "
     "Tweaking this value allow better accuracy in power usage measurement by limiting the execution.";
 
+/// @brief message for open-loop rate
+static const char qps_message[] =
+    "Optional. Enables the open-loop load: requests arrive at the given rate (requests per second) independently of "
+    "the completion of the previous ones and wait in the queue until an infer request is idle. "
+    "End-to-end and queue wait latencies are reported in addition to the inference latency.";
+
+/// @brief message for open-loop arrival process
+static const char arrival_message[] =
+    "Optional. Arrival process of the open-loop load: \"poisson\" (default), \"constant\" or a path to a trace file "
+    "with arrival timestamps in milliseconds, one per line. The trace is replayed in a loop and rescaled to -qps "
+    "if it is set.";
+
+/// @brief message for latency SLO
+static const char slo_message[] =
+    "Optional. End-to-end latency SLO in milliseconds. Enables the sweep of the open-loop load which searches for the "
+    "maximum rate meeting the SLO, starting from -qps (1 request per second if not set). Every step of the sweep runs "
+    "for -t seconds or -niter requests.";
+
+/// @brief message for latency SLO percentile
+static const char slo_percentile_message[] =
+    "Optional. Percentile of end-to-end latency checked against -slo. The valid range is (0, 100]. "
+    "The default value is 99.";
+
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
@@ -283,6 +306,18 @@ DEFINE_uint64(niter, 0, iterations_count_message);
 /// @brief Time to execute topology in seconds
 DEFINE_uint64(t, 0, execution_time_message);
 
+/// @brief Rate of the open-loop load in requests per second
+DEFINE_double(qps, 0, qps_message);
+
+/// @brief Arrival process of the open-loop load
+DEFINE_string(arrival, "", arrival_message);
+
+/// @brief End-to-end latency SLO in milliseconds for the open-loop sweep
+DEFINE_double(slo, 0, slo_message);
+
+/// @brief Percentile of end-to-end latency checked against the SLO
+DEFINE_double(slo_percentile, 99, slo_percentile_message);
+
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_uint64(b, 0, batch_size_message);
@@ -406,6 +441,12 @@ static void show_usage() {
     std::cout << "    -max_irate \"<float>\"        " << maximum_inference_rate_message << std::endl;
     std::cout << "    -t                            " << execution_time_message << std::endl;
     std::cout << std::endl;
+    std::cout << "Open-loop load options" << std::endl;
+    std::cout << "    -qps \"<float>\"              " << qps_message << std::endl;
+    std::cout << "    -arrival  <type or path>      " << arrival_message << std::endl;
+    std::cout << "    -slo \"<float>\"              " << slo_message << std::endl;
+    std::cout << "    -slo_percentile \"<float>\"   " << slo_percentile_message << std::endl;
+    std::cout << std::endl;
     std::cout << "Input shapes" << std::endl;
     std::cout << "    -b  <integer>                 " << batch_size_message << std::endl;
     std::cout << "    -shape                        " << shape_message << std::endl;
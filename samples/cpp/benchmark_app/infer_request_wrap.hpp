@@ -47,6 +47,7 @@ public:
 
     void start_async() {
         _startTime = Time::now();
+        update_arrival_time();
         _request.start_async();
     }
 
@@ -56,6 +57,7 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        update_arrival_time();
         _request.infer();
         _endTime = Time::now();
         _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), nullptr);
@@ -83,10 +85,28 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    /// @brief Time spent by the request in the queue before it was started
+    double get_queue_wait_in_milliseconds() const {
+        auto waitTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(waitTime.count()) * 0.000001;
+    }
+
+    /// @brief Time from the request arrival to its completion
+    double get_end_to_end_time_in_milliseconds() const {
+        auto totalTime = std::chrono::duration_cast<ns>(_endTime - _arrivalTime);
+        return static_cast<double>(totalTime.count()) * 0.000001;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
 
+    /// @brief Sets the arrival time of the next started request, by default a request arrives when it is started
+    void set_arrival_time(const Time::time_point& arrivalTime) {
+        _arrivalTime = arrivalTime;
+        _hasArrivalTime = true;
+    }
+
     // in case of using GPU memory we need to allocate CL buffer for
     // output blobs. By encapsulating cl buffer inside InferReqWrap
     // we will control the number of output buffers and access to it.
@@ -95,9 +115,18 @@ public:
     }
 
 private:
+    void update_arrival_time() {
+        if (!_hasArrivalTime) {
+            _arrivalTime = _startTime;
+        }
+        _hasArrivalTime = false;
+    }
+
     ov::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
+    bool _hasArrivalTime = false;
     size_t _id;
     size_t _lat_group_id;
     QueueCallbackFunction _callbackQueue;
@@ -137,6 +166,8 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueWaits.clear();
+        _endToEndLatencies.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -155,6 +186,8 @@ public:
             inferenceException = ptr;
         } else {
             _latencies.push_back(latency);
+            _queueWaits.push_back(requests.at(id)->get_queue_wait_in_milliseconds());
+            _endToEndLatencies.push_back(requests.at(id)->get_end_to_end_time_in_milliseconds());
             if (enable_lat_groups) {
                 _latency_groups[lat_group_id].push_back(latency);
             }
@@ -178,6 +211,25 @@ public:
         return request;
     }
 
+    /// @brief Waits for an idle request until the deadline
+    /// @return the idle request or nullptr if no request became idle till the deadline
+    InferReqWrap::Ptr get_idle_request_until(const Time::time_point& deadline) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        const bool ready = _cv.wait_until(lock, deadline, [this] {
+            if (inferenceException) {
+                std::rethrow_exception(inferenceException);
+            }
+            return _idleIds.size() > 0;
+        });
+        if (!ready) {
+            return nullptr;
+        }
+        auto request = requests.at(_idleIds.front());
+        _idleIds.pop();
+        _startTime = std::min(Time::now(), _startTime);
+        return request;
+    }
+
     void wait_all() {
         std::unique_lock<std::mutex> lock(_mutex);
         _cv.wait(lock, [this] {
@@ -192,6 +244,14 @@ public:
         return _latencies;
     }
 
+    std::vector<double> get_queue_waits() {
+        return _queueWaits;
+    }
+
+    std::vector<double> get_end_to_end_latencies() {
+        return _endToEndLatencies;
+    }
+
     std::vector<std::vector<double>> get_latency_groups() {
         return _latency_groups;
     }
@@ -205,6 +265,8 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueWaits;
+    std::vector<double> _endToEndLatencies;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
     std::exception_ptr inferenceException = nullptr;
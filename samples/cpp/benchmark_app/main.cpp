@@ -32,6 +32,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "open_loop.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -120,6 +121,10 @@ int64_t get_peak_memory_usage() {
 
 #endif
 
+bool is_open_loop_load() {
+    return FLAGS_qps != 0 || !FLAGS_arrival.empty() || FLAGS_slo != 0;
+}
+
 bool parse_and_check_command_line(int argc, char* argv[]) {
     // ---------------------------Parsing and validating input
     // arguments--------------------------------------
@@ -140,8 +145,9 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         show_usage();
         throw std::logic_error("The percentile value is incorrect. The applicable values range is [1, 100].");
     }
+    const bool openLoop = is_open_loop_load();
     if (FLAGS_api == "") {
-        FLAGS_api = FLAGS_hint == "latency" ? "sync" : "async";
+        FLAGS_api = FLAGS_hint == "latency" && !openLoop ? "sync" : "async";
     }
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
@@ -152,6 +158,24 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
                 "Number of iterations should be greater than number of infer requests when using sync API.");
         }
     }
+    if (openLoop) {
+        if (FLAGS_qps < 0 || FLAGS_slo < 0) {
+            throw std::logic_error("The -qps and -slo values should be positive.");
+        }
+        if (FLAGS_slo_percentile <= 0 || FLAGS_slo_percentile > 100) {
+            throw std::logic_error("The SLO percentile value is incorrect. The applicable values range is (0, 100].");
+        }
+        if (FLAGS_api != "async") {
+            throw std::logic_error("The open-loop load requires async API. Please set -api option to `async` value.");
+        }
+        if (FLAGS_max_irate != 0) {
+            throw std::logic_error("The -max_irate option can't be used with the open-loop load, use -qps instead.");
+        }
+        const bool traceArrival = !FLAGS_arrival.empty() && FLAGS_arrival != "poisson" && FLAGS_arrival != "constant";
+        if (FLAGS_qps == 0 && FLAGS_slo == 0 && !traceArrival) {
+            throw std::logic_error("The rate of the open-loop load is required. Please set -qps option.");
+        }
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "cumulative_throughput" && FLAGS_hint != "ctput" && FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -1152,6 +1176,15 @@ int main(int argc, char* argv[]) {
                 ss << " using " << device_ss.str();
             }
         }
+        if (is_open_loop_load()) {
+            ss << ", open-loop load with " << (FLAGS_arrival.empty() ? "poisson" : FLAGS_arrival) << " arrivals";
+            if (FLAGS_qps > 0) {
+                ss << " at " << double_to_string(FLAGS_qps) << " requests/s";
+            }
+            if (FLAGS_slo > 0) {
+                ss << ", searching for the maximum rate under " << double_to_string(FLAGS_slo) << " ms SLO";
+            }
+        }
         ss << ", limits: ";
         if (duration_seconds > 0) {
             ss << get_duration_in_milliseconds(duration_seconds) << " ms duration";
@@ -1256,73 +1289,120 @@ int main(int argc, char* argv[]) {
             slog::info << "Skipping warmup inference due to -no_warmup flag" << slog::endl;
         }
 
-        size_t processedFramesN = 0;
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                OPENVINO_THROW("No idle Infer Requests!");
+        // set the inputs of the iteration for full mode
+        auto fill_request = [&](const InferReqWrap::Ptr& inferRequest, size_t iteration) {
+            auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
+
+            if (FLAGS_pcseq) {
+                inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
             }
 
-            if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
+            if (isDynamicNetwork) {
+                batchSize = get_batch_size(inputs);
+            }
 
-                if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
-                }
+            for (auto& item : inputs) {
+                auto inputName = item.first;
+                const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
+                inferRequest->set_tensor(inputName, data);
+            }
 
-                if (isDynamicNetwork) {
-                    batchSize = get_batch_size(inputs);
+            if (useGpuMem) {
+                auto outputTensors =
+                    ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
+                for (auto& output : compiledModel.outputs()) {
+                    inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
                 }
+            }
+        };
 
-                for (auto& item : inputs) {
-                    auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
-                    inferRequest->set_tensor(inputName, data);
+        const bool openLoop = is_open_loop_load();
+        size_t processedFramesN = 0;
+        std::vector<double> latencies;
+        std::vector<std::vector<double>> latencyGroups;
+        double totalDuration = 0;
+        std::shared_ptr<benchmark_app::OpenLoopResult> openLoopResult;
+        if (openLoop) {
+            benchmark_app::RequestPreparer prepare = [&](const InferReqWrap::Ptr& inferRequest, size_t iteration) {
+                if (!inferenceOnly) {
+                    fill_request(inferRequest, iteration);
+                }
+                return batchSize;
+            };
+            benchmark_app::OpenLoopLimits limits{niter, duration_nanoseconds};
+            if (FLAGS_slo > 0) {
+                openLoopResult = std::make_shared<benchmark_app::OpenLoopResult>(
+                    benchmark_app::find_max_rate_under_slo(inferRequestsQueue,
+                                                           FLAGS_arrival,
+                                                           FLAGS_qps > 0 ? FLAGS_qps : 1.0,
+                                                           limits,
+                                                           prepare,
+                                                           FLAGS_slo,
+                                                           FLAGS_slo_percentile));
+            } else {
+                benchmark_app::ArrivalProcess arrivals(FLAGS_arrival, FLAGS_qps);
+                openLoopResult = std::make_shared<benchmark_app::OpenLoopResult>(
+                    benchmark_app::run_open_loop(inferRequestsQueue, arrivals, limits, prepare));
+            }
+            iteration = openLoopResult->iterations;
+            processedFramesN = openLoopResult->processedFrames;
+            latencies = openLoopResult->inferenceLatencies;
+            // the groups of the selected rate, not of the last step of the sweep
+            latencyGroups = openLoopResult->latencyGroups;
+            totalDuration = openLoopResult->durationMs;
+        } else {
+            auto startTime = Time::now();
+            auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+
+            /** Start inference & calculate performance **/
+            /** to align number if iterations to guarantee that last infer requests are
+             * executed in the same conditions **/
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    OPENVINO_THROW("No idle Infer Requests!");
                 }
 
-                if (useGpuMem) {
-                    auto outputTensors =
-                        ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
-                    for (auto& output : compiledModel.outputs()) {
-                        inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
-                    }
+                if (!inferenceOnly) {
+                    fill_request(inferRequest, iteration);
                 }
-            }
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                inferRequest->start_async();
-            }
-            ++iteration;
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer();
+                } else {
+                    inferRequest->start_async();
+                }
+                ++iteration;
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-            processedFramesN += batchSize;
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                processedFramesN += batchSize;
 
-            if (FLAGS_max_irate > 0) {
-                auto nextRunFinishTime = 1 / FLAGS_max_irate * processedFramesN * 1.0e9;
-                std::this_thread::sleep_for(
-                    std::chrono::nanoseconds(static_cast<int64_t>(nextRunFinishTime - execTime)));
+                if (FLAGS_max_irate > 0) {
+                    auto nextRunFinishTime = 1 / FLAGS_max_irate * processedFramesN * 1.0e9;
+                    std::this_thread::sleep_for(
+                        std::chrono::nanoseconds(static_cast<int64_t>(nextRunFinishTime - execTime)));
+                }
             }
-        }
 
-        // wait the latest inference executions
-        inferRequestsQueue.wait_all();
+            // wait the latest inference executions
+            inferRequestsQueue.wait_all();
+            latencies = inferRequestsQueue.get_latencies();
+            latencyGroups = inferRequestsQueue.get_latency_groups();
+            totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
+        }
 
-        LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
+        // nothing is measured when no rate of the open-loop load meets the SLO
+        const bool hasLatencies = !latencies.empty();
+        LatencyMetrics generalLatency;
+        if (hasLatencies) {
+            generalLatency = LatencyMetrics(latencies, "", FLAGS_latency_percentile);
+        }
         std::vector<LatencyMetrics> groupLatencies = {};
-        if (FLAGS_pcseq && app_inputs_info.size() > 1) {
-            const auto& lat_groups = inferRequestsQueue.get_latency_groups();
-            for (size_t i = 0; i < lat_groups.size(); i++) {
-                const auto& lats = lat_groups[i];
+        if (hasLatencies && FLAGS_pcseq && app_inputs_info.size() > 1) {
+            for (size_t i = 0; i < latencyGroups.size(); i++) {
+                const auto& lats = latencyGroups[i];
 
                 std::string data_shapes_string = "";
                 for (auto& item : app_inputs_info[i]) {
@@ -1335,14 +1415,13 @@ int main(int argc, char* argv[]) {
             }
         }
 
-        double totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
-        double fps = 1000.0 * processedFramesN / totalDuration;
+        double fps = totalDuration > 0 ? 1000.0 * processedFramesN / totalDuration : 0;
 
         if (statistics) {
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("total execution time (ms)", "execution_time", totalDuration),
                                         StatisticsVariant("total number of iterations", "iterations_num", iteration)});
-            if (device_name.find("MULTI") == std::string::npos) {
+            if (hasLatencies && device_name.find("MULTI") == std::string::npos) {
                 std::string latency_label;
                 if (FLAGS_latency_percentile == 50) {
                     latency_label = "Median latency (ms)";
@@ -1365,8 +1444,28 @@ int main(int argc, char* argv[]) {
                     }
                 }
             }
-            statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
-                                       {StatisticsVariant("throughput", "throughput", fps)});
+            if (hasLatencies) {
+                statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                           {StatisticsVariant("throughput", "throughput", fps)});
+            }
+            if (openLoopResult && hasLatencies) {
+                benchmark_app::TailLatencyMetrics endToEnd(openLoopResult->endToEndLatencies);
+                benchmark_app::TailLatencyMetrics queueWait(openLoopResult->queueWaits);
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant(FLAGS_slo > 0 ? "max offered rate under SLO (requests/s)"
+                                                     : "offered rate (requests/s)",
+                                       "offered_rate",
+                                       openLoopResult->offeredRate),
+                     StatisticsVariant("end-to-end latency p50 (ms)", "e2e_latency_p50", endToEnd.p50),
+                     StatisticsVariant("end-to-end latency p90 (ms)", "e2e_latency_p90", endToEnd.p90),
+                     StatisticsVariant("end-to-end latency p99 (ms)", "e2e_latency_p99", endToEnd.p99),
+                     StatisticsVariant("end-to-end latency p99.9 (ms)", "e2e_latency_p99_9", endToEnd.p999),
+                     StatisticsVariant("queue wait p50 (ms)", "queue_wait_p50", queueWait.p50),
+                     StatisticsVariant("queue wait p90 (ms)", "queue_wait_p90", queueWait.p90),
+                     StatisticsVariant("queue wait p99 (ms)", "queue_wait_p99", queueWait.p99),
+                     StatisticsVariant("queue wait p99.9 (ms)", "queue_wait_p99_9", queueWait.p999)});
+            }
         }
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
@@ -1421,7 +1520,11 @@ int main(int argc, char* argv[]) {
         slog::info << "Count:               " << iteration << " iterations" << slog::endl;
         slog::info << "Duration:            " << double_to_string(totalDuration) << " ms" << slog::endl;
 
-        if (device_name.find("MULTI") == std::string::npos) {
+        if (!hasLatencies) {
+            slog::warn << (FLAGS_slo > 0 ? "No rate of the open-loop load meets the SLO"
+                                         : "No inference request of the open-loop load has completed")
+                       << ", the latency and throughput are not reported" << slog::endl;
+        } else if (device_name.find("MULTI") == std::string::npos) {
             slog::info << "Latency:" << slog::endl;
             generalLatency.write_to_slog();
 
@@ -1443,7 +1546,18 @@ int main(int argc, char* argv[]) {
             }
         }
 
-        slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
+        if (hasLatencies) {
+            slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
+        }
+
+        if (openLoopResult && hasLatencies) {
+            slog::info << (FLAGS_slo > 0 ? "Max offered rate under SLO: " : "Offered rate:        ")
+                       << double_to_string(openLoopResult->offeredRate) << " requests/s" << slog::endl;
+            slog::info << "End-to-end latency:" << slog::endl;
+            benchmark_app::TailLatencyMetrics(openLoopResult->endToEndLatencies).write_to_slog();
+            slog::info << "Queue wait:" << slog::endl;
+            benchmark_app::TailLatencyMetrics(openLoopResult->queueWaits).write_to_slog();
+        }
 
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
@@ -0,0 +1,222 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include "open_loop.hpp"
+// clang-format on
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+// clang-format off
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+// clang-format on
+
+namespace benchmark_app {
+
+namespace {
+// the seed is fixed to offer the same load to the compared configurations
+constexpr uint64_t arrival_seed = 42;
+constexpr size_t max_sweep_steps = 20;
+constexpr double sweep_tolerance = 0.05;
+}  // namespace
+
+ArrivalProcess::ArrivalProcess(const std::string& type, double rate)
+    : _rate(rate),
+      _generator(arrival_seed),
+      _interval(rate > 0 ? rate : 1.0) {
+    if (type.empty() || type == "poisson") {
+        _type = Type::POISSON;
+    } else if (type == "constant") {
+        _type = Type::CONSTANT;
+    } else {
+        _type = Type::TRACE;
+    }
+    if (_type != Type::TRACE) {
+        if (_rate <= 0) {
+            throw std::logic_error("The rate of the " + type + " arrivals should be positive.");
+        }
+        return;
+    }
+
+    std::ifstream file(type);
+    if (!file.is_open()) {
+        throw std::logic_error("Can't open the arrival trace file: " + type);
+    }
+    double timestamp = 0;
+    while (file >> timestamp) {
+        if (!_trace.empty() && timestamp < _trace.back()) {
+            throw std::logic_error("The timestamps of the arrival trace should be sorted: " + type);
+        }
+        _trace.push_back(timestamp);
+    }
+    if (!file.eof()) {
+        throw std::logic_error("Can't parse the arrival trace file: " + type);
+    }
+    if (_trace.size() < 2 || _trace.back() == _trace.front()) {
+        throw std::logic_error("The arrival trace should contain at least two distinct timestamps: " + type);
+    }
+
+    // the offsets from the first arrival in nanoseconds, rescaled to the requested rate if any
+    const double meanInterval = (_trace.back() - _trace.front()) / (_trace.size() - 1) * 1.0e6;
+    const double scale = _rate > 0 ? 1.0e9 / _rate / meanInterval : 1.0;
+    const double first = _trace.front();
+    for (auto& offset : _trace) {
+        offset = (offset - first) * 1.0e6 * scale;
+    }
+    _tracePeriod = _trace.back() + meanInterval * scale;
+    _rate = 1.0e9 / (meanInterval * scale);
+}
+
+double ArrivalProcess::next() {
+    switch (_type) {
+    case Type::POISSON:
+        _time += _interval(_generator) * 1.0e9;
+        return _time;
+    case Type::CONSTANT:
+        _time += 1.0e9 / _rate;
+        return _time;
+    case Type::TRACE:
+    default:
+        if (_traceIndex == _trace.size()) {
+            _traceIndex = 0;
+            _traceLoop++;
+        }
+        return _trace[_traceIndex++] + _tracePeriod * _traceLoop;
+    }
+}
+
+OpenLoopResult run_open_loop(InferRequestsQueue& inferRequestsQueue,
+                             ArrivalProcess& arrivals,
+                             const OpenLoopLimits& limits,
+                             const RequestPreparer& prepare) {
+    OpenLoopResult result;
+    result.offeredRate = arrivals.get_rate();
+
+    std::deque<Time::time_point> pending;
+    size_t arrived = 0;
+    double nextOffset = arrivals.next();
+    auto has_next_arrival = [&] {
+        return (limits.niter == 0 || arrived < limits.niter) &&
+               (limits.duration_nanoseconds == 0 || nextOffset < limits.duration_nanoseconds);
+    };
+    const auto startTime = Time::now();
+    auto next_arrival_time = [&] {
+        return startTime + ns(static_cast<int64_t>(nextOffset));
+    };
+
+    bool moreArrivals = has_next_arrival();
+    while (moreArrivals || !pending.empty()) {
+        const auto now = Time::now();
+        while (moreArrivals && next_arrival_time() <= now) {
+            pending.push_back(next_arrival_time());
+            arrived++;
+            nextOffset = arrivals.next();
+            moreArrivals = has_next_arrival();
+        }
+        if (pending.empty()) {
+            std::this_thread::sleep_until(next_arrival_time());
+            continue;
+        }
+
+        // do not miss the next arrival while waiting for an idle request
+        auto inferRequest = moreArrivals ? inferRequestsQueue.get_idle_request_until(next_arrival_time())
+                                         : inferRequestsQueue.get_idle_request();
+        if (!inferRequest) {
+            continue;
+        }
+        result.processedFrames += prepare(inferRequest, result.iterations);
+        inferRequest->set_arrival_time(pending.front());
+        pending.pop_front();
+        inferRequest->start_async();
+        result.iterations++;
+    }
+
+    inferRequestsQueue.wait_all();
+    result.durationMs = inferRequestsQueue.get_duration_in_milliseconds();
+    result.inferenceLatencies = inferRequestsQueue.get_latencies();
+    result.queueWaits = inferRequestsQueue.get_queue_waits();
+    result.endToEndLatencies = inferRequestsQueue.get_end_to_end_latencies();
+    result.latencyGroups = inferRequestsQueue.get_latency_groups();
+    return result;
+}
+
+OpenLoopResult find_max_rate_under_slo(InferRequestsQueue& inferRequestsQueue,
+                                       const std::string& arrivalType,
+                                       double initialRate,
+                                       const OpenLoopLimits& limits,
+                                       const RequestPreparer& prepare,
+                                       double sloMs,
+                                       double sloPercentile) {
+    OpenLoopResult best;
+    double low = 0;
+    double high = 0;
+    double rate = initialRate;
+    for (size_t step = 0; step < max_sweep_steps; step++) {
+        inferRequestsQueue.reset_times();
+        ArrivalProcess arrivals(arrivalType, rate);
+        auto result = run_open_loop(inferRequestsQueue, arrivals, limits, prepare);
+        const double latency = get_percentile(result.endToEndLatencies, sloPercentile);
+        const bool meetsSlo = !result.endToEndLatencies.empty() && latency <= sloMs;
+        slog::info << "Offered rate " << double_to_string(result.offeredRate) << " requests/s: "
+                   << double_to_string(sloPercentile) << " percentile of end-to-end latency is "
+                   << double_to_string(latency) << " ms, the SLO is " << (meetsSlo ? "met" : "violated")
+                   << slog::endl;
+        if (meetsSlo) {
+            low = rate;
+            best = std::move(result);
+        } else {
+            high = rate;
+        }
+
+        if (high == 0) {
+            rate *= 2;
+        } else if (high - low <= sweep_tolerance * high) {
+            break;
+        } else {
+            rate = (low + high) / 2;
+        }
+    }
+    return best;
+}
+
+double get_percentile(std::vector<double> latencies, double percentile) {
+    if (latencies.empty()) {
+        return 0;
+    }
+    // nearest-rank method
+    auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * latencies.size()));
+    rank = std::min(std::max<size_t>(rank, 1), latencies.size());
+    std::nth_element(latencies.begin(), latencies.begin() + (rank - 1), latencies.end());
+    return latencies[rank - 1];
+}
+
+TailLatencyMetrics::TailLatencyMetrics(const std::vector<double>& latencies) {
+    if (latencies.empty()) {
+        return;
+    }
+    p50 = get_percentile(latencies, 50);
+    p90 = get_percentile(latencies, 90);
+    p99 = get_percentile(latencies, 99);
+    p999 = get_percentile(latencies, 99.9);
+    avg = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
+    max = *std::max_element(latencies.begin(), latencies.end());
+}
+
+void TailLatencyMetrics::write_to_slog() const {
+    slog::info << "   p50:        " << double_to_string(p50) << " ms" << slog::endl;
+    slog::info << "   p90:        " << double_to_string(p90) << " ms" << slog::endl;
+    slog::info << "   p99:        " << double_to_string(p99) << " ms" << slog::endl;
+    slog::info << "   p99.9:      " << double_to_string(p999) << " ms" << slog::endl;
+    slog::info << "   Average:    " << double_to_string(avg) << " ms" << slog::endl;
+    slog::info << "   Max:        " << double_to_string(max) << " ms" << slog::endl;
+}
+
+}  // namespace benchmark_app
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "infer_request_wrap.hpp"
+#include "utils.hpp"
+// clang-format on
+
+namespace benchmark_app {
+
+/// @brief Generates the arrival times of the open-loop load
+class ArrivalProcess {
+public:
+    /// @param type "poisson", "constant" or a path to a trace file with arrival timestamps in milliseconds, one per
+    /// line. The trace is replayed in a loop.
+    /// @param rate the rate of arrivals in requests per second. The trace is rescaled to the rate if it is not zero.
+    ArrivalProcess(const std::string& type, double rate);
+
+    /// @brief Returns the offset of the next arrival from the start of the load in nanoseconds
+    double next();
+
+    /// @brief Returns the mean rate of arrivals in requests per second
+    double get_rate() const {
+        return _rate;
+    }
+
+private:
+    enum class Type { POISSON, CONSTANT, TRACE };
+
+    Type _type;
+    double _rate = 0;
+    double _time = 0;
+    std::mt19937_64 _generator;
+    std::exponential_distribution<double> _interval;
+    std::vector<double> _trace;
+    double _tracePeriod = 0;
+    size_t _traceIndex = 0;
+    size_t _traceLoop = 0;
+};
+
+struct OpenLoopLimits {
+    uint64_t niter = 0;
+    uint64_t duration_nanoseconds = 0;
+};
+
+struct OpenLoopResult {
+    double offeredRate = 0;
+    size_t iterations = 0;
+    size_t processedFrames = 0;
+    double durationMs = 0;
+    std::vector<double> inferenceLatencies;
+    std::vector<double> queueWaits;
+    std::vector<double> endToEndLatencies;
+    std::vector<std::vector<double>> latencyGroups;
+};
+
+/// @brief Prepares the request before it is started
+/// @return the number of frames processed by the request
+using RequestPreparer = std::function<size_t(const InferReqWrap::Ptr& request, size_t iteration)>;
+
+/// @brief Starts the requests at the arrival times independently of the completion of the previous ones. The arrived
+/// requests wait in the queue until an infer request is idle, the waiting time is reported as the queue wait.
+OpenLoopResult run_open_loop(InferRequestsQueue& inferRequestsQueue,
+                             ArrivalProcess& arrivals,
+                             const OpenLoopLimits& limits,
+                             const RequestPreparer& prepare);
+
+/// @brief Searches for the maximum rate of arrivals which meets the latency SLO: the rate is doubled until the SLO is
+/// violated, then the boundary is bisected
+/// @return the result of the open-loop load at the maximum rate, empty if no rate meets the SLO
+OpenLoopResult find_max_rate_under_slo(InferRequestsQueue& inferRequestsQueue,
+                                       const std::string& arrivalType,
+                                       double initialRate,
+                                       const OpenLoopLimits& limits,
+                                       const RequestPreparer& prepare,
+                                       double sloMs,
+                                       double sloPercentile);
+
+/// @brief Returns the percentile of the latencies, percentile is in the (0, 100] range
+double get_percentile(std::vector<double> latencies, double percentile);
+
+/// @brief Responsible for calculating the tail latency metrics of the open-loop load
+class TailLatencyMetrics {
+public:
+    explicit TailLatencyMetrics(const std::vector<double>& latencies);
+
+    void write_to_slog() const;
+
+    double p50 = 0;
+    double p90 = 0;
+    double p99 = 0;
+    double p999 = 0;
+    double avg = 0;
+    double max = 0;
+};
+
+}  // namespace benchmark_app
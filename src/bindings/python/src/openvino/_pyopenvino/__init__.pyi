@@ -86,6 +86,33 @@ class AsyncInferQueue:
                     :param callback: Any Python defined function that matches callback's requirements.
                     :type callback: function
         """
+    def set_batched_callback(self, callback: collections.abc.Callable, max_batch_size: typing.SupportsInt | typing.SupportsIndex = 0) -> None:
+        """
+                    Sets unified callback on all InferRequests from queue's pool, which is
+                    called once for a batch of finished InferRequests.
+        
+                    Finished InferRequests are collected without taking the GIL, and a
+                    dedicated thread calls the callback for all the requests finished
+                    since the previous call. Signature of such function should have one
+                    argument, a list of tuples (request, userdata, results) where results
+                    is a dictionary of outputs exposed as NumPy arrays sharing memory
+                    with the output tensors. The requests are returned to the pool when
+                    the callback returns, so the arrays must be copied to be used later.
+        
+                    .. code-block:: python
+        
+                        def f(completions):
+                            for request, userdata, results in completions:
+                                print(userdata, {output.any_name: array.sum() for output, array in results.items()})
+        
+                        async_infer_queue.set_batched_callback(f)
+        
+                    :param callback: Any Python defined function that matches callback's requirements.
+                    :type callback: function
+                    :param max_batch_size: Maximum number of requests passed to a single call,
+                    0 means no limit. Default: 0
+                    :type max_batch_size: int
+        """
     @typing.overload
     def start_async(self, inputs: Tensor, userdata: typing.Any) -> None:
         """
@@ -5169,6 +5196,15 @@ class VariableState:
                 Reset internal variable state for relevant infer request,
                 to a value specified as default for according node.
         """
+    def set_state_from(self, source: VariableState) -> None:
+        """
+                Sets the new state for the next inference to the value of another state of the same variable,
+                e.g. to fork the state of one infer request into another one. The plugin may share the source
+                state memory by reference and copy it only when either of the states is updated.
+        
+                :param source: The state to take the value from.
+                :type source: openvino.VariableState
+        """
     @property
     def name(self) -> str:
         """
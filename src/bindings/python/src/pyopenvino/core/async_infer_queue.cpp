@@ -12,6 +12,7 @@
 #include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -45,6 +46,7 @@ public:
         // Release the GIL before destroying requests. m_requests.clear() triggers a C++ destructor chain that
         // eventually joins plugin executor threads (via CoreImpl dtor).
         py::gil_scoped_release release;
+        stop_dispatcher();
         m_requests.clear();
     }
 
@@ -83,7 +85,11 @@ public:
             request.m_request.wait();
         }
         // acquire the mutex to access m_errors
-        std::lock_guard<std::mutex> lock(m_mutex);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // finished requests may still wait for the batched callback
+        m_cv.wait(lock, [this] {
+            return m_completed.empty() && m_dispatched == 0;
+        });
         if (m_errors.size() > 0)
             throw m_errors.front();
     }
@@ -115,6 +121,10 @@ public:
     }
 
     void set_custom_callbacks(py::function f_callback) {
+        {
+            py::gil_scoped_release release;
+            stop_dispatcher();
+        }
         // need to acquire GIL before py::function deletion
         auto callback_sp = Common::utils::wrap_pyfunction(std::move(f_callback));
 
@@ -158,6 +168,51 @@ public:
         }
     }
 
+    void set_batched_callbacks(py::function f_callback, size_t max_batch_size) {
+        {
+            py::gil_scoped_release release;
+            stop_dispatcher();
+        }
+        // need to acquire GIL before py::function deletion
+        auto callback_sp = Common::utils::wrap_pyfunction(std::move(f_callback));
+        m_max_batch_size = max_batch_size;
+
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            // The GIL is not taken here, the finished request is handed over to the dispatcher thread which calls
+            // the Python callback once for all the requests finished meanwhile
+            m_requests[handle].m_request.set_callback([this, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                {
+                    // acquire the mutex to access m_completed and m_idle_handles
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (exception_ptr) {
+                        m_idle_handles.push(handle);
+                    } else {
+                        m_completed.push(handle);
+                    }
+                }
+                if (exception_ptr) {
+                    // Notify locks in getIdleRequestId()
+                    m_cv.notify_all();
+                } else {
+                    m_completed_cv.notify_one();
+                }
+
+                try {
+                    if (exception_ptr) {
+                        std::rethrow_exception(exception_ptr);
+                    }
+                } catch (const std::exception& e) {
+                    OPENVINO_THROW(e.what());
+                }
+            });
+        }
+
+        m_dispatcher = std::thread([this, callback_sp] {
+            dispatch_completions(callback_sp);
+        });
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
@@ -166,6 +221,96 @@ public:
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<py::error_already_set> m_errors;
+
+private:
+    void dispatch_completions(const std::shared_ptr<py::function>& callback) {
+        std::vector<size_t> batch;
+        while (true) {
+            {
+                // acquire the mutex to access m_completed
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_completed_cv.wait(lock, [this] {
+                    return m_stop_dispatcher || !m_completed.empty();
+                });
+                // the pending completions are delivered before the dispatcher stops
+                if (m_completed.empty()) {
+                    return;
+                }
+                while (!m_completed.empty() && (m_max_batch_size == 0 || batch.size() < m_max_batch_size)) {
+                    batch.push_back(m_completed.front());
+                    m_completed.pop();
+                }
+                m_dispatched = batch.size();
+            }
+
+            {
+                // For free-threaded Python, gil_scoped_acquire still ensures thread is attached
+                py::gil_scoped_acquire acquire;
+                try {
+                    py::list completions;
+                    for (auto handle : batch) {
+                        // outputs are the views of the request tensors, they are valid till the callback returns
+                        completions.append(py::make_tuple(m_requests[handle],
+                                                          m_user_ids[handle],
+                                                          Common::outputs_to_dict(m_requests[handle], true, true)));
+                    }
+                    (*callback)(completions);
+                } catch (const py::error_already_set& py_error) {
+                    assert(py_error.type());
+                    // acquire the mutex to access m_errors
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_errors.push(py_error);
+                } catch (const std::exception& e) {
+                    // an exception can't leave the dispatcher thread, it is raised by the flow control functions
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+                    py::error_already_set py_error;
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_errors.push(py_error);
+                }
+            }
+
+            {
+                // acquire the mutex to access m_idle_handles
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (auto handle : batch) {
+                    m_idle_handles.push(handle);
+                }
+                m_dispatched = 0;
+            }
+            // Notify locks in getIdleRequestId() and wait_all()
+            m_cv.notify_all();
+            batch.clear();
+        }
+    }
+
+    // must be called without the GIL, the dispatcher delivers the pending completions before it stops
+    void stop_dispatcher() {
+        if (!m_dispatcher.joinable()) {
+            return;
+        }
+        for (auto&& request : m_requests) {
+            try {
+                request.m_request.wait();
+            } catch (...) {
+                // the failed request is already returned to the idle ones
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop_dispatcher = true;
+        }
+        m_completed_cv.notify_one();
+        m_dispatcher.join();
+        m_stop_dispatcher = false;
+    }
+
+    // batched callback mode: the finished requests waiting for the dispatcher
+    std::queue<size_t> m_completed;
+    size_t m_dispatched = 0;
+    size_t m_max_batch_size = 0;
+    bool m_stop_dispatcher = false;
+    std::condition_variable m_completed_cv;
+    std::thread m_dispatcher;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -325,6 +470,37 @@ void regclass_AsyncInferQueue(py::module m) {
             :type callback: function
         )");
 
+    cls.def("set_batched_callback",
+            &AsyncInferQueue::set_batched_callbacks,
+            py::arg("callback"),
+            py::arg("max_batch_size") = 0,
+            R"(
+            Sets unified callback on all InferRequests from queue's pool, which is
+            called once for a batch of finished InferRequests.
+
+            Finished InferRequests are collected without taking the GIL, and a
+            dedicated thread calls the callback for all the requests finished
+            since the previous call. Signature of such function should have one
+            argument, a list of tuples (request, userdata, results) where results
+            is a dictionary of outputs exposed as NumPy arrays sharing memory
+            with the output tensors. The requests are returned to the pool when
+            the callback returns, so the arrays must be copied to be used later.
+
+            .. code-block:: python
+
+                def f(completions):
+                    for request, userdata, results in completions:
+                        print(userdata, {output.any_name: array.sum() for output, array in results.items()})
+
+                async_infer_queue.set_batched_callback(f)
+
+            :param callback: Any Python defined function that matches callback's requirements.
+            :type callback: function
+            :param max_batch_size: Maximum number of requests passed to a single call,
+            0 means no limit. Default: 0
+            :type max_batch_size: int
+        )");
+
     cls.def(
         "__len__",
         [](AsyncInferQueue& self) {
@@ -37,8 +37,20 @@ void regclass_VariableState(py::module m) {
 
     variable_st.def_property("state",
                              &ov::VariableState::get_state,
-                             &ov::VariableState::set_state,
+                             py::overload_cast<const ov::Tensor&>(&ov::VariableState::set_state),
                              R"(
         Gets/sets variable state.
     )");
+
+    variable_st.def("set_state_from",
+                    py::overload_cast<const ov::VariableState&>(&ov::VariableState::set_state),
+                    py::arg("source"),
+                    R"(
+        Sets the new state for the next inference to the value of another state of the same variable,
+        e.g. to fork the state of one infer request into another one. The plugin may share the source
+        state memory by reference and copy it only when either of the states is updated.
+
+        :param source: The state to take the value from.
+        :type source: openvino.VariableState
+    )");
 }
@@ -189,6 +189,64 @@ def test_infer_queue_get_idle_handle(device):
     queue.wait_all()
 
 
+@pytest.mark.parametrize("max_batch_size", [0, 1, 3])
+def test_infer_queue_batched_callback(device, max_batch_size):
+    jobs = 16
+    num_request = 4
+    core = Core()
+    param = ops.parameter([10], np.float32, name="data")
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    batch_sizes = []
+    results = {}
+
+    def callback(completions):
+        batch_sizes.append(len(completions))
+        for _, job_id, outputs in completions:
+            array = next(iter(outputs.values()))
+            # the arrays share memory with the output tensors
+            assert not array.flags["OWNDATA"]
+            results[job_id] = array.copy()
+
+    infer_queue.set_batched_callback(callback, max_batch_size)
+    for i in range(jobs):
+        infer_queue.start_async({"data": np.full([10], i - 8, dtype=np.float32)}, i)
+    infer_queue.wait_all()
+
+    assert sum(batch_sizes) == jobs
+    if max_batch_size:
+        assert max(batch_sizes) <= max_batch_size
+    for i in range(jobs):
+        assert np.array_equal(results[i], np.full([10], max(i - 8, 0), dtype=np.float32))
+
+    # switching back to a per-request callback stops the batched dispatch
+    finished = []
+    infer_queue.set_callback(lambda request, job_id: finished.append(job_id))
+    for i in range(jobs):
+        infer_queue.start_async({"data": np.zeros([10], dtype=np.float32)}, i)
+    infer_queue.wait_all()
+    assert sorted(finished) == list(range(jobs))
+
+
+def test_infer_queue_batched_callback_fail(device):
+    core = Core()
+    param = ops.parameter([10], np.float32, name="data")
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+
+    def callback(completions):
+        raise ValueError("batched callback failed")
+
+    infer_queue.set_batched_callback(callback)
+    with pytest.raises(ValueError) as e:
+        infer_queue.start_async({"data": np.zeros([10], dtype=np.float32)})
+        infer_queue.wait_all()
+
+    assert "batched callback failed" in str(e.value)
+
+
 @pytest.mark.parametrize("share_inputs", [True, False])
 def test_results_async_infer(device, share_inputs):
     jobs = 8
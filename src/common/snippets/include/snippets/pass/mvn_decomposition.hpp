@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::snippets::pass {
+
+/**
+ * @interface MVNDecomposition
+ * @brief Decomposes MVN by the last dimension to a range of low-level operations
+ * @ingroup snippets
+ */
+class MVNDecomposition : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("snippets::pass::MVNDecomposition");
+    MVNDecomposition();
+};
+
+}  // namespace ov::snippets::pass
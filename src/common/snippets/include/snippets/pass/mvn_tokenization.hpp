@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "openvino/core/node.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "snippets/pass/tokenization_config.hpp"
+
+namespace ov::snippets::pass {
+
+/**
+ * @interface TokenizeMVNSnippets
+ * @brief The pass tokenizes MVN by the last dimension (LayerNorm) with its residual Add and post-ops into Subgraph
+ *        Pattern:
+ *          Input  Input
+ *              \  /
+ *         [Add (residual)]
+ *               |
+ *              MVN
+ *               |
+ *      [Multiply (scale)]  Constant
+ *               |         /
+ *        [Add (shift)]  Constant
+ *               |
+ *      [FakeQuantize or Convert]
+ *        Note: the ops in brackets are optional.
+ * @ingroup snippets
+ */
+class TokenizeMVNSnippets : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("snippets::pass::TokenizeMVNSnippets");
+    explicit TokenizeMVNSnippets(const TokenizationConfig& config);
+
+    static bool is_supported_mvn(const std::shared_ptr<const ov::Node>& node);
+};
+
+}  // namespace ov::snippets::pass
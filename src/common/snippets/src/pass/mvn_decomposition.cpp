@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/mvn_decomposition.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/power.hpp"
+#include "openvino/op/sqrt.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "snippets/itt.hpp"
+#include "snippets/op/powerstatic.hpp"
+#include "snippets/op/reduce.hpp"
+#include "snippets/pass/mvn_tokenization.hpp"
+
+namespace ov::snippets::pass {
+
+// mvn = (x - mean) / Sqrt(ReduceMean((x - mean) ^ 2) + eps) if eps is inside sqrt,
+// mvn = (x - mean) / (Sqrt(ReduceMean((x - mean) ^ 2)) + eps) if eps is outside sqrt,
+// where mean = ReduceMean(x) by the last dimension
+MVNDecomposition::MVNDecomposition() {
+    MATCHER_SCOPE(MVNDecomposition);
+    auto mvn_pattern = ov::pass::pattern::wrap_type<ov::op::v6::MVN>();
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::pass::MVNDecomposition")
+        auto mvn_node = ov::as_type_ptr<ov::op::v6::MVN>(m.get_match_root());
+        OPENVINO_ASSERT(TokenizeMVNSnippets::is_supported_mvn(mvn_node),
+                        "MVN decomposition in snippets supports only static f32 normalization by the last dimension.");
+
+        const auto data = mvn_node->input_value(0);
+        const auto& shape = mvn_node->get_input_shape(0);
+        const auto axis = shape.size() - 1;
+        const auto eps = mvn_node->get_eps();
+
+        // reduceMean
+        const auto reduce_sum = std::make_shared<ov::snippets::op::ReduceSum>(data, axis);
+        op::ReduceBase::compute_and_set_reduce_subtensors(reduce_sum);
+        const float size_inv = 1.0F / static_cast<float>(shape.back());
+        const auto size_inv_node =
+            std::make_shared<ov::op::v0::Constant>(element::f32, Shape{}, std::vector<float>{size_inv});
+        const auto reduce_mean = std::make_shared<ov::op::v1::Multiply>(reduce_sum, size_inv_node);
+
+        // x - mean
+        const auto sub_mean = std::make_shared<ov::op::v1::Subtract>(data, reduce_mean);
+        // (x - mean) ^ 2
+        const auto sqr_const = std::make_shared<ov::op::v0::Constant>(element::f32, Shape{1}, std::vector<float>{2});
+        const auto sqr = std::make_shared<ov::op::v1::Power>(sub_mean, sqr_const);
+        // reduceSum((x - mean) ^ 2)
+        const auto sqr_reduce_sum = std::make_shared<ov::snippets::op::ReduceSum>(sqr, axis);
+        op::ReduceBase::compute_and_set_reduce_subtensors(sqr_reduce_sum);
+        // reduceMean((x - mean) ^ 2)
+        const auto size_inv_node_aux =
+            std::make_shared<ov::op::v0::Constant>(element::f32, Shape{}, std::vector<float>{size_inv});
+        const auto sqr_mean = std::make_shared<ov::op::v1::Multiply>(sqr_reduce_sum, size_inv_node_aux);
+
+        // variance = sqrt(reduceMean((x - mean) ^ 2) + eps) or sqrt(reduceMean((x - mean) ^ 2)) + eps
+        const auto eps_node = std::make_shared<ov::op::v0::Constant>(element::f32, Shape{1}, std::vector<float>{eps});
+        std::shared_ptr<ov::Node> variance = nullptr;
+        if (mvn_node->get_eps_mode() == ov::op::MVNEpsMode::INSIDE_SQRT) {
+            const auto eps_add = std::make_shared<ov::op::v1::Add>(sqr_mean, eps_node);
+            variance = std::make_shared<ov::op::v0::Sqrt>(eps_add);
+        } else {
+            const auto sqrt = std::make_shared<ov::op::v0::Sqrt>(sqr_mean);
+            variance = std::make_shared<ov::op::v1::Add>(sqrt, eps_node);
+        }
+        // divide variance
+        const auto variance_inv = std::make_shared<ov::snippets::op::PowerStatic>(variance, -1.F);
+        const auto mvn = std::make_shared<ov::op::v1::Multiply>(sub_mean, variance_inv);
+
+        copy_runtime_info(mvn_node, {reduce_sum, reduce_mean, sub_mean, sqr, sqr_reduce_sum, sqr_mean, variance, mvn});
+        return ov::replace_node_update_name(mvn_node, mvn);
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(mvn_pattern, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::snippets::pass
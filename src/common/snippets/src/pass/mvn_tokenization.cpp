@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/mvn_tokenization.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/fake_quantize.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "openvino/util/pp.hpp"
+#include "snippets/itt.hpp"
+#include "snippets/pass/collapse_subgraph.hpp"
+#include "snippets/pass/tokenization.hpp"
+#include "snippets/pass/tokenization_config.hpp"
+#include "snippets/utils/tokenization_utils.hpp"
+
+namespace ov::snippets::pass {
+
+using namespace ov::pass::pattern;
+
+namespace {
+bool has_single_consumer(const std::shared_ptr<ov::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+std::shared_ptr<ov::Node> get_single_consumer(const std::shared_ptr<ov::Node>& node) {
+    return has_single_consumer(node) ? node->get_output_target_inputs(0).begin()->get_node()->shared_from_this()
+                                     : nullptr;
+}
+
+// Returns true if the node is an elementwise op of the expected type which applies a per-feature Constant
+// (e.g. LayerNorm gamma and beta) to the parent output
+template <typename OpType>
+bool is_affine_op(const std::shared_ptr<ov::Node>& node,
+                  const std::shared_ptr<ov::Node>& parent,
+                  const ov::Shape& data_shape) {
+    if (!ov::is_type<OpType>(node) || !TokenizeSnippets::AppropriateForSubgraph(node)) {
+        return false;
+    }
+    const auto parent_idx = node->get_input_node_shared_ptr(0) == parent ? 0 : 1;
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(1 - parent_idx));
+    if (!constant || node->get_output_shape(0) != data_shape) {
+        return false;
+    }
+    const auto& shape = constant->get_output_shape(0);
+    const auto features = shape.empty() ? 1 : shape.back();
+    return shape.size() <= data_shape.size() && ov::shape_size(shape) == features &&
+           (features == 1 || features == data_shape.back());
+}
+}  // namespace
+
+bool TokenizeMVNSnippets::is_supported_mvn(const std::shared_ptr<const ov::Node>& node) {
+    const auto mvn = ov::as_type_ptr<const ov::op::v6::MVN>(node);
+    if (!mvn || mvn->is_dynamic() || mvn->get_element_type() != element::f32 || !mvn->get_normalize_variance()) {
+        return false;
+    }
+    const auto axes = ov::as_type_ptr<const ov::op::v0::Constant>(mvn->get_input_node_shared_ptr(1));
+    if (!axes) {
+        return false;
+    }
+    // Only the normalization by the last dimension (LayerNorm) is supported: it is the innermost loop of the kernel
+    const auto rank = static_cast<int64_t>(mvn->get_input_partial_shape(0).size());
+    const auto axes_values = axes->cast_vector<int64_t>();
+    return axes_values.size() == 1 && (axes_values[0] == rank - 1 || axes_values[0] == -1);
+}
+
+TokenizeMVNSnippets::TokenizeMVNSnippets(const TokenizationConfig& config) {
+    MATCHER_SCOPE(TokenizeMVNSnippets);
+
+    auto m_mvn = wrap_type<ov::op::v6::MVN>({any_input(), wrap_type<ov::op::v0::Constant>()});
+
+    register_matcher(std::make_shared<Matcher>(m_mvn, matcher_name), [OV_CAPTURE_CPY_AND_THIS](Matcher& m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::pass::TokenizeMVNSnippets")
+        const auto mvn = m.get_match_root();
+        if (!is_supported_mvn(mvn) || transformation_callback(mvn)) {
+            return false;
+        }
+        const auto& data_shape = mvn->get_output_shape(0);
+
+        ov::NodeVector ordered_ops;
+        // The residual Add is fused only if MVN is its single consumer, otherwise its result must be stored anyway
+        const auto residual = mvn->get_input_node_shared_ptr(0);
+        if (ov::is_type<ov::op::v1::Add>(residual) && has_single_consumer(residual) &&
+            residual->get_input_partial_shape(0) == data_shape && residual->get_input_partial_shape(1) == data_shape &&
+            GetSnippetsNodeType(residual) != SnippetsNodeType::SkippedByPlugin &&
+            TokenizeSnippets::AppropriateForSubgraph(residual)) {
+            ordered_ops.push_back(residual);
+        }
+        ordered_ops.push_back(mvn);
+
+        // Note: MVN and its post-ops might be marked as SkippedByPlugin to be fused into the plugin MVN node.
+        // They are not checked here since the Subgraph replaces this fusing.
+        auto child = get_single_consumer(mvn);
+        if (child && is_affine_op<ov::op::v1::Multiply>(child, ordered_ops.back(), data_shape)) {
+            ordered_ops.push_back(child);
+            child = get_single_consumer(child);
+        }
+        if (child && is_affine_op<ov::op::v1::Add>(child, ordered_ops.back(), data_shape)) {
+            ordered_ops.push_back(child);
+            child = get_single_consumer(child);
+        }
+        if (child && ov::is_type_any_of<ov::op::v0::FakeQuantize, ov::op::v0::Convert>(child) &&
+            TokenizeSnippets::AppropriateForSubgraph(child)) {
+            ordered_ops.push_back(child);
+        }
+
+        // Standalone MVN is executed by the plugin node as efficiently: there is nothing to fuse
+        if (ordered_ops.size() == 1) {
+            return false;
+        }
+
+        // The first input of the chain + the inputs of the fused ops + 1x result
+        size_t io_count = 2;
+        for (const auto& op : ordered_ops) {
+            io_count += ov::snippets::utils::get_potential_body_params(op);
+        }
+        // The reductions are computed in the loops by the last dimension nested into the loop by the outer dimensions
+        static constexpr size_t n_reg_group = 0;
+        static constexpr size_t n_loops_depth = 2;
+        // TODO [75567]: move this plugin-specific constraint to the plugin callback
+        if (!config.is_gprs_count_sufficient(io_count, n_reg_group, n_loops_depth)) {
+            return false;
+        }
+
+        const auto subgraph = ov::snippets::utils::tokenize_ordered_nodes(ordered_ops);
+
+        // Mark the Subgraph as Completed to not allow Snippets to include any nodes into this Subgraph in common
+        // Tokenization: the parallel domain of MVN excludes the normalized dimension
+        SetSnippetsSubgraphType(subgraph, SnippetsSubgraphType::Completed);
+        return true;
+    });
+}
+
+}  // namespace ov::snippets::pass
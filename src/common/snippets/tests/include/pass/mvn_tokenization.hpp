@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <common_test_utils/ov_test_utils.hpp>
+
+#include "snippets/pass/tokenization.hpp"
+#include "subgraph_mvn.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+typedef std::tuple<
+        std::vector<PartialShape>,       // Input Shapes: the second one is the residual input
+        MVNFunction::PostOp              // The last op of the chain
+> MVNParams;
+
+class TokenizeMVNSnippetsTests : public TransformationTestsF, public testing::WithParamInterface<MVNParams> {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MVNParams> obj);
+protected:
+    void SetUp() override;
+    std::shared_ptr<MVNFunction> snippets_model;
+};
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
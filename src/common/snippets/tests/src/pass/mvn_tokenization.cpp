@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <pass/mvn_tokenization.hpp>
+#include "snippets/pass/mvn_tokenization.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "utils.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::string TokenizeMVNSnippetsTests::getTestCaseName(testing::TestParamInfo<MVNParams> obj) {
+    const auto& [input_shapes, post_op] = obj.param;
+    std::ostringstream result;
+    result << "IS=" << ov::test::utils::partialShape2str(input_shapes) << "_";
+    result << "PostOp=" << post_op;
+    return result.str();
+}
+
+void TokenizeMVNSnippetsTests::SetUp() {
+    TransformationTestsF::SetUp();
+
+    const auto& [input_shapes, post_op] = this->GetParam();
+    snippets_model = std::make_shared<MVNFunction>(input_shapes, post_op);
+    manager.register_pass<ov::snippets::pass::TokenizeMVNSnippets>(get_default_tokenization_config());
+}
+
+TEST_P(TokenizeMVNSnippetsTests, smoke_TokenizeMVNSnippets) {
+    model = snippets_model->getOriginal();
+    model_ref = snippets_model->getReference();
+}
+
+TEST_F(TransformationTestsF, smoke_TokenizeMVNSnippets_NotLastDim) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{2, 16, 64});
+    auto residual = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{2, 16, 64});
+    auto add = std::make_shared<op::v1::Add>(data, residual);
+    auto axes = op::v0::Constant::create(element::i64, Shape{1}, {1});
+    auto mvn = std::make_shared<op::v6::MVN>(add, axes, true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+    model = std::make_shared<ov::Model>(OutputVector{mvn}, ParameterVector{data, residual});
+    manager.register_pass<ov::snippets::pass::TokenizeMVNSnippets>(get_default_tokenization_config());
+}
+
+namespace TokenizeMVNSnippetsTestsInstantiation {
+
+static const std::vector<std::vector<ov::PartialShape>> input_shapes{{{2, 16, 64}},
+                                                                     {{2, 16, 64}, {2, 16, 64}},
+                                                                     {{32, 768}, {32, 768}}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_MVNTokenize,
+                         TokenizeMVNSnippetsTests,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes),
+                                            ::testing::Values(MVNFunction::PostOp::None,
+                                                              MVNFunction::PostOp::FakeQuantize,
+                                                              MVNFunction::PostOp::Convert)),
+                         TokenizeMVNSnippetsTests::getTestCaseName);
+
+}  // namespace TokenizeMVNSnippetsTestsInstantiation
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -116,4 +116,21 @@ void vm_decommit(void* ptr, size_t size) noexcept;
  * @pre  ptr != nullptr && size > 0; violated preconditions are a programming error (assert fires in debug).
  */
 void vm_release(void* ptr, size_t size) noexcept;
+
+/**
+ * @brief Advises the OS that a committed region is not going to be accessed soon, so its physical pages may be
+ * reclaimed ahead of the other memory: written to the swap or to the file the region is mapped from.
+ * The content is preserved and the pages are read back on the next access. The call is a no-op if not supported.
+ * @param ptr   Page-aligned base address of the region.
+ * @param size  Multiple of the system page size.
+ */
+void vm_page_out(void* ptr, size_t size) noexcept;
+
+/**
+ * @brief Advises the OS that a region is going to be accessed soon, so the paged out pages are read back in the
+ * background. The call does not wait for the read.
+ * @param ptr   Page-aligned base address of the region.
+ * @param size  Multiple of the system page size.
+ */
+void vm_will_need(void* ptr, size_t size) noexcept;
 }  // namespace ov::util
@@ -200,6 +200,23 @@ void vm_release(void* ptr, size_t size) noexcept {
     std::ignore = munmap(ptr, size);
 }
 
+void vm_page_out(void* ptr, size_t size) noexcept {
+    assert(ptr != nullptr && size > 0);
+#if defined(MADV_PAGEOUT)
+    std::ignore = madvise(ptr, size, MADV_PAGEOUT);
+#elif defined(MADV_COLD)
+    std::ignore = madvise(ptr, size, MADV_COLD);
+#else
+    std::ignore = ptr;
+    std::ignore = size;
+#endif
+}
+
+void vm_will_need(void* ptr, size_t size) noexcept {
+    assert(ptr != nullptr && size > 0);
+    std::ignore = madvise(ptr, size, MADV_WILLNEED);
+}
+
 void vm_prefetch(void* ptr, size_t size, size_t num_threads) noexcept {
     assert(ptr != nullptr && size > 0);
     if (num_threads == 0) {
@@ -62,6 +62,18 @@ void vm_release(void* ptr, size_t) noexcept {
     std::ignore = VirtualFree(ptr, 0, MEM_RELEASE);
 }
 
+void vm_page_out(void* ptr, size_t size) noexcept {
+    assert(ptr != nullptr && size > 0);
+    // unlocking the pages that are not locked removes them from the working set
+    std::ignore = VirtualUnlock(ptr, size);
+}
+
+void vm_will_need(void* ptr, size_t size) noexcept {
+    assert(ptr != nullptr && size > 0);
+    WIN32_MEMORY_RANGE_ENTRY entry{ptr, size};
+    ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &entry, 0);
+}
+
 void vm_prefetch(void* ptr, size_t size, size_t num_threads) noexcept {
     assert(ptr != nullptr && size > 0);
     if (num_threads == 0) {
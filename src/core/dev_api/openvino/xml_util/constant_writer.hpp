@@ -6,6 +6,7 @@
 
 #include <iostream>
 #include <map>
+#include <memory>
 #include <string_view>
 #include <vector>
 
@@ -37,15 +38,26 @@ public:
         return m_data_hash;
     }
 
+    /// @brief Waits until the written data reaches the output stream. The data is written by a background thread, so
+    /// the stream must not be accessed before the flush.
+    void flush();
+
 private:
+    class WriteBehind;
+
+    FilePosition get_write_position() const;
+
+    void write_data(const char* ptr, size_t size, std::shared_ptr<const void> owner);
+
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
                                                          const element::Type& src_type,
                                                          size_t& compressed_size);
 
     ConstWritePositions m_hash_to_file_positions;
-    std::vector<std::vector<char>> m_packed_string_data;
+    std::vector<std::shared_ptr<std::vector<char>>> m_packed_string_data;
     std::reference_wrapper<std::ostream> m_binary_output;
+    std::shared_ptr<WriteBehind> m_write_behind;  // shared with the copies as they write to the same stream
     bool m_enable_compression;
     FilePosition m_blob_offset;  // blob offset inside output stream
     uint64_t m_data_hash;
@@ -4,8 +4,14 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/core/weight_sharing_util.hpp"
@@ -102,6 +108,208 @@ static void remove_requires_precision_conversion_attribute(const std::shared_ptr
     }
 }
 
+namespace {
+
+// An independent subgraph of the nodes which depend on constants only, e.g. a weights decompression chain. It is folded
+// as a whole on a detached copy, so that the subgraphs can be folded concurrently without touching the shared graph.
+// Only the results of its sinks, i.e. of the nodes consumed outside of the subgraph, are kept for the sequential pass.
+struct ConstantSubgraph {
+    size_t first = 0;                // position of the first node in the ordered ops
+    std::vector<ov::Node*> nodes;    // in the topological order
+    std::unordered_set<const ov::Node*> sinks;
+    std::unordered_map<const ov::Node*, ov::OutputVector> results;
+};
+
+using PrefoldedNodes = std::unordered_map<const ov::Node*, ConstantSubgraph*>;
+
+// Checks that the node is folded as is once its inputs are folded, i.e. neither its precision nor the precision of its
+// inputs is changed right before the folding
+bool is_foldable_as_is(const std::shared_ptr<ov::Node>& node) {
+    if (node->get_input_size() == 0 || ov::op::util::is_output(node.get()) || ov::op::util::is_sink(node.get()) ||
+        ov::is_type_any_of<ov::op::util::MultiSubGraphOp, ov::op::util::ReadValueBase>(node) ||
+        ov::pass::constant_folding_is_disabled(node) || node_has_requires_precision_conversion_attribute(node)) {
+        return false;
+    }
+    if (ov::is_type<ov::op::v0::Convert>(node) && !is_decompression(node) && !is_dequantization_node(node)) {
+        return true;
+    }
+    for (const auto& input : node->inputs()) {
+        if (ov::util::has_original_input_precision(input) &&
+            ov::util::get_original_input_precision(input) != input.get_element_type()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Splits the nodes depending on constants only into the independent subgraphs, ordered by their first node
+std::vector<ConstantSubgraph> collect_constant_subgraphs(const ov::NodeVector& nodes) {
+    std::unordered_map<const ov::Node*, size_t> subgraph_ids;
+    std::vector<size_t> parents;
+    const auto find_root = [&parents](size_t id) {
+        while (parents[id] != id) {
+            id = parents[id] = parents[parents[id]];
+        }
+        return id;
+    };
+
+    for (const auto& node : nodes) {
+        if (!is_foldable_as_is(node)) {
+            continue;
+        }
+        std::optional<size_t> id;
+        bool foldable = true;
+        for (const auto& input : node->input_values()) {
+            if (ov::is_type<ov::op::v0::Constant>(input.get_node())) {
+                continue;
+            }
+            const auto it = subgraph_ids.find(input.get_node());
+            if (it == subgraph_ids.end()) {
+                foldable = false;
+                break;
+            }
+            const auto root = find_root(it->second);
+            if (!id) {
+                id = root;
+            } else if (*id != root) {
+                parents[root] = *id;
+            }
+        }
+        if (!foldable) {
+            continue;
+        }
+        if (!id) {
+            // the inputs are constants already, so the check is exact here
+            if (!node->can_constant_fold(node->input_values())) {
+                continue;
+            }
+            id = parents.size();
+            parents.push_back(*id);
+        }
+        subgraph_ids.emplace(node.get(), *id);
+    }
+
+    std::vector<ConstantSubgraph> subgraphs;
+    std::unordered_map<size_t, size_t> positions;
+    for (size_t n = 0; n < nodes.size(); ++n) {
+        const auto it = subgraph_ids.find(nodes[n].get());
+        if (it == subgraph_ids.end()) {
+            continue;
+        }
+        const auto root = find_root(it->second);
+        const auto position = positions.emplace(root, subgraphs.size());
+        if (position.second) {
+            subgraphs.emplace_back();
+            subgraphs.back().first = n;
+        }
+        auto& subgraph = subgraphs[position.first->second];
+        subgraph.nodes.push_back(nodes[n].get());
+        for (const auto& output : nodes[n]->outputs()) {
+            const auto& consumers = output.get_target_inputs();
+            const auto is_consumed_outside = [&](const ov::Input<ov::Node>& consumer) {
+                const auto consumer_id = subgraph_ids.find(consumer.get_node());
+                return consumer_id == subgraph_ids.end() || find_root(consumer_id->second) != root;
+            };
+            if (consumers.empty() || std::any_of(consumers.begin(), consumers.end(), is_consumed_outside)) {
+                subgraph.sinks.insert(nodes[n].get());
+            }
+        }
+    }
+    return subgraphs;
+}
+
+// Folds a copy of the subgraph connected to the copies of its constant inputs and keeps the results of its sinks. An
+// intermediate result is released as soon as its last consumer in the subgraph is folded.
+bool fold_detached(ConstantSubgraph& subgraph) {
+    std::unordered_map<const ov::Node*, size_t> uses;
+    for (const auto* node : subgraph.nodes) {
+        for (const auto& input : node->input_values()) {
+            if (!ov::is_type<ov::op::v0::Constant>(input.get_node())) {
+                ++uses[input.get_node()];
+            }
+        }
+    }
+
+    std::unordered_map<const ov::Node*, ov::OutputVector> values;
+    for (const auto* node : subgraph.nodes) {
+        ov::OutputVector inputs;
+        for (const auto& input : node->input_values()) {
+            if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(input.get_node_shared_ptr())) {
+                auto constant_copy = std::make_shared<ov::op::v0::Constant>(*constant);
+                constant_copy->set_friendly_name(constant->get_friendly_name());
+                constant_copy->get_rt_info() = constant->get_rt_info();
+                inputs.push_back(constant_copy);
+            } else {
+                inputs.push_back(values.at(input.get_node())[input.get_index()]);
+            }
+        }
+        const auto node_copy = node->clone_with_new_inputs(inputs);
+        node_copy->set_friendly_name(node->get_friendly_name());
+        node_copy->get_rt_info() = node->get_rt_info();
+        ov::OutputVector replacements(node_copy->get_output_size());
+        if (!node_copy->constant_fold(replacements, node_copy->input_values())) {
+            return false;
+        }
+        for (const auto& replacement : replacements) {
+            if (!replacement.get_node() || replacement.get_node() == node_copy.get()) {
+                return false;
+            }
+        }
+        for (const auto& input : node->input_values()) {
+            const auto* producer = input.get_node();
+            if (ov::is_type<ov::op::v0::Constant>(producer)) {
+                continue;
+            }
+            if (--uses[producer] == 0 && !subgraph.sinks.count(producer)) {
+                values.erase(producer);
+            }
+        }
+        values.emplace(node, std::move(replacements));
+    }
+
+    for (const auto* sink : subgraph.sinks) {
+        subgraph.results.emplace(sink, std::move(values.at(sink)));
+    }
+    return true;
+}
+
+// Folds concurrently the subgraphs starting from `next`, at most `slots` of them, and registers the nodes of the folded
+// ones. Returns the number of the folded subgraphs; the rest are left to the sequential pass.
+size_t prefold(std::vector<ConstantSubgraph>& subgraphs, size_t& next, size_t slots, PrefoldedNodes& prefolded) {
+    const auto begin = next;
+    const auto end = std::min(subgraphs.size(), begin + slots);
+    next = std::max(end, begin + 1);
+    // a single subgraph is not worth the detached copy
+    if (end < begin + 2) {
+        return 0;
+    }
+
+    std::vector<char> folded(end - begin, 0);
+    ov::parallel_for(end - begin, [&](size_t i) {
+        try {
+            folded[i] = fold_detached(subgraphs[begin + i]);
+        } catch (...) {
+            // the subgraph is folded sequentially, so the error is reported in the topological order
+        }
+    });
+
+    size_t count = 0;
+    for (size_t i = begin; i < end; ++i) {
+        auto& subgraph = subgraphs[i];
+        if (!folded[i - begin]) {
+            subgraph.results.clear();
+            continue;
+        }
+        for (const auto* node : subgraph.nodes) {
+            prefolded.emplace(node, &subgraph);
+        }
+        ++count;
+    }
+    return count;
+}
+
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
@@ -110,9 +318,84 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
     // Creating a local vector and moving each element to reduce memory peak.
     // Elements of 'nodes' vector are nullptr after the std::move in the loop.
     auto nodes = model->get_ordered_ops();
+    // The independent constant subgraphs, e.g. the weights decompression chains, are folded concurrently ahead of the
+    // sequential pass, which then only replaces their sinks in the graph. At most one subgraph per thread has its
+    // results held at a time, and each result is released once it replaces its node.
+    auto subgraphs = collect_constant_subgraphs(nodes);
+    PrefoldedNodes prefolded;
+    size_t next_subgraph = 0;
+    size_t in_flight = 0;
+    const auto max_in_flight = static_cast<size_t>(std::max(parallel_get_max_threads(), 1));
+
+    const auto replace_outputs = [&](const std::shared_ptr<Node>& original_node,
+                                     const std::shared_ptr<Node>& node,
+                                     const OutputVector& replacements) {
+        OPENVINO_ASSERT(!constant_folding_is_disabled(original_node),
+                        "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                        node);
+        OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                        "constant_fold_default returned incorrect number of replacements for ",
+                        node);
+
+        for (size_t i = 0; i < replacements.size(); ++i) {
+            auto node_output = original_node->output(i);
+            const auto& replacement = replacements.at(i);
+            auto replacement_ptr = replacement.get_node_shared_ptr();
+            if (replacement_ptr && (node_output != replacement)) {
+                replacement_ptr->set_friendly_name(friendly_name_from(*original_node, replacements.size(), i));
+
+                node_output.replace(replacement);
+                // Copy runtime info from source nodes
+                // when it was not propogated during pre-calculation
+                copy_runtime_info_from_input_values(original_node);
+                // Propagate runtime info attributes to replacement
+                copy_runtime_info(original_node, replacement_ptr);
+                ov::copy_weightless_cache_attr(original_node, replacement_ptr);
+                // Evict data if original node is constant or convert with constant input
+                if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(original_node)) {
+                    ov::wsh::Extension::hint_evict(*constant);
+                } else if (auto convert = ov::as_type_ptr<ov::op::v0::Convert>(original_node)) {
+                    if (auto const_input = ov::as_type<ov::op::v0::Constant>(convert->get_input_node_ptr(0))) {
+                        ov::wsh::Extension::hint_evict(*const_input);
+                    }
+                }
+
+                rewritten = true;
+            }
+        }
+    };
+
     for (size_t n = 0; n < nodes.size(); ++n) {
         auto original_node = std::move(nodes[n]);
         auto node = original_node;
+        // the subgraphs passed while the limit was reached are folded sequentially
+        while (next_subgraph < subgraphs.size() && subgraphs[next_subgraph].first < n) {
+            ++next_subgraph;
+        }
+        if (next_subgraph < subgraphs.size() && subgraphs[next_subgraph].first == n) {
+            in_flight += prefold(subgraphs, next_subgraph, max_in_flight - in_flight, prefolded);
+        }
+        if (const auto it = prefolded.find(original_node.get()); it != prefolded.end()) {
+            auto& subgraph = *it->second;
+            prefolded.erase(it);
+            auto result = subgraph.results.extract(original_node.get());
+            if (!result.empty()) {
+                replace_outputs(original_node, original_node, result.mapped());
+            } else {
+                // an intermediate node is removed with the replacement of the sinks consuming it, so only its runtime
+                // info is propagated as if it was folded
+                copy_runtime_info_from_input_values(original_node);
+                if (ov::is_type<ov::op::v0::Convert>(original_node)) {
+                    if (auto const_input = ov::as_type<ov::op::v0::Constant>(original_node->get_input_node_ptr(0))) {
+                        ov::wsh::Extension::hint_evict(*const_input);
+                    }
+                }
+            }
+            if (subgraph.results.empty() && !result.empty()) {
+                --in_flight;
+            }
+            continue;
+        }
         if (!original_node->can_constant_fold(original_node->input_values())) {
             if (auto sub_graph_node = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
                 // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
@@ -141,39 +424,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
 
         OutputVector replacements(node->get_output_size());
         if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(original_node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = original_node->output(i);
-                const auto& replacement = replacements.at(i);
-                auto replacement_ptr = replacement.get_node_shared_ptr();
-                if (replacement_ptr && (node_output != replacement)) {
-                    replacement_ptr->set_friendly_name(friendly_name_from(*original_node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(original_node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(original_node, replacement_ptr);
-                    ov::copy_weightless_cache_attr(original_node, replacement_ptr);
-                    // Evict data if original node is constant or convert with constant input
-                    if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(original_node)) {
-                        ov::wsh::Extension::hint_evict(*constant);
-                    } else if (auto convert = ov::as_type_ptr<ov::op::v0::Convert>(original_node)) {
-                        if (auto const_input = ov::as_type<ov::op::v0::Constant>(convert->get_input_node_ptr(0))) {
-                            ov::wsh::Extension::hint_evict(*const_input);
-                        }
-                    }
-
-                    rewritten = true;
-                }
-            }
+            replace_outputs(original_node, node, replacements);
         } else {
             // if CF was unsuccessful remove original precision attribute from inputs
             bool restored = restore_original_input_precision(original_node);
@@ -9,6 +9,7 @@
 #include <iostream>
 #include <regex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -16,6 +17,10 @@
 #include "openvino/core/log_util.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/backward_graph_rewrite.hpp"
+#include "openvino/pass/pattern/op/any_output.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/optional.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
@@ -66,6 +71,53 @@ PerfCounters& perf_counters_graph_rewrite() {
 }  // namespace ov
 
 #endif  // ENABLE_PROFILING_ITT_FULL
+
+namespace {
+/**
+ * \brief Collects the types of the nodes a pattern root can be matched to.
+ *
+ * The root is typed if it is an operation from opset or a pattern::op::WrapType, or if it is built only of typed
+ * roots, e.g. an Or of WrapTypes or a Label with a predicate wrapping a typed pattern.
+ *
+ * \param root        Pattern root to check.
+ * \param root_types  Collected types, the nodes of derived types are matched as well.
+ *
+ * \return false if the root can be matched to a node of any type.
+ */
+bool collect_root_types(const ov::Output<ov::Node>& root, std::vector<ov::NodeTypeInfo>& root_types) {
+    const auto node = root.get_node();
+    if (!dynamic_cast<ov::pass::pattern::op::Pattern*>(node)) {
+        root_types.push_back(node->get_type_info());
+        return true;
+    }
+    if (const auto wrap_type = ov::as_type<ov::pass::pattern::op::WrapType>(node)) {
+        const auto& wrapped_types = wrap_type->get_wrapped_types();
+        root_types.insert(root_types.end(), wrapped_types.begin(), wrapped_types.end());
+        return true;
+    }
+    if (const auto optional = ov::as_type<ov::pass::pattern::op::Optional>(node)) {
+        // matches either the optional types or the first input if the optional node is absent
+        const auto optional_types = optional->get_optional_types();
+        root_types.insert(root_types.end(), optional_types.begin(), optional_types.end());
+        return optional->get_input_size() == 0 || collect_root_types(optional->input_value(0), root_types);
+    }
+    // pattern::op::AnyOutput operation automatically appends for multi output operations inside
+    // Matcher and the Label predicate is checked on top of its wrapped pattern, so the types come from the inputs
+    if (ov::is_type<ov::pass::pattern::op::AnyOutput>(node) || ov::is_type<ov::pass::pattern::op::Label>(node)) {
+        return collect_root_types(node->input_value(0), root_types);
+    }
+    if (ov::is_type<ov::pass::pattern::op::Or>(node)) {
+        for (const auto& input : node->input_values()) {
+            if (!collect_root_types(input, root_types)) {
+                return false;
+            }
+        }
+        return node->get_input_size() != 0;
+    }
+    return false;
+}
+}  // namespace
+
 std::shared_ptr<ov::pass::MatcherPass> ov::pass::GraphRewrite::add_matcher(
     const std::shared_ptr<ov::pass::MatcherPass>& pass) {
     auto pass_config = get_pass_config();
@@ -101,48 +153,59 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Matchers with a type based root node are indexed by the root types for fast MatcherPass search. The rest of
+    // the matchers are tried on every node.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> untyped_matchers;
+    std::vector<NodeTypeInfo> root_types;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher) {
-            all_roots_has_type = false;
-            break;
-        }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = ov::as_type_ptr<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
-        }
-
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = ov::as_type_ptr<ov::pass::pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
+        root_types.clear();
+        if (matcher && collect_root_types(matcher->get_pattern_value(), root_types)) {
+            for (const auto& root_type_info : root_types) {
+                auto& matchers = type_to_matcher[root_type_info];
+                // the same type may come from several branches of the root
+                if (matchers.empty() || matchers.back() != matcher_index) {
+                    matchers.push_back(matcher_index);
                 }
-            } else {
-                all_roots_has_type = false;
-                break;
             }
         } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
+            untyped_matchers.push_back(matcher_index);
         }
 
         // TODO: traverse parents for root_type_info in order to register complete list of matchers
         // including ones triggered by parent type info.
     }
 
+    // The matchers for the node type merged with the untyped ones in order of the registration, they are collected
+    // once per type
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matchers_to_run;
+    auto get_matchers_to_run = [&](const NodeTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto found = type_to_matchers_to_run.find(type_info);
+        if (found != type_to_matchers_to_run.end()) {
+            return found->second;
+        }
+        std::vector<size_t> matcher_passes_to_run(untyped_matchers);
+        // need to collect all matchers for parents as well
+        for (const DiscreteTypeInfo* node_type_info = &type_info; node_type_info;
+             node_type_info = node_type_info->parent) {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end()) {
+                matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                             matchers->second.begin(),
+                                             matchers->second.end());
+            }
+        }
+        std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+        matcher_passes_to_run.erase(std::unique(matcher_passes_to_run.begin(), matcher_passes_to_run.end()),
+                                    matcher_passes_to_run.end());
+        return type_to_matchers_to_run.emplace(type_info, std::move(matcher_passes_to_run)).first->second;
+    };
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
@@ -175,9 +238,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -200,47 +260,10 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+        for (size_t matcher_index : get_matchers_to_run(node->get_type_info())) {
+            if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                rewritten = true;
+                break;
             }
         }
     }
@@ -84,6 +84,7 @@ void serialize_func(std::ostream& xml_file,
 
     xml_doc.save(xml_file);
     xml_file.flush();
+    constant_writer.flush();
     bin_file.flush();
 }
 
@@ -230,6 +231,7 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ov::Model>& model
     const auto visitor = make_serializer(net_node, name, constant_write_handler, version);
     std::shared_ptr<ov::Model> fun = model;
     visitor->on_attribute(name, fun);
+    constant_write_handler.flush();
 
     // IR
     hdr.model_offset = static_cast<size_t>(m_stream.tellp()) - header_offset;
@@ -4,33 +4,201 @@
 
 #include "openvino/xml_util/constant_writer.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/reference/convert.hpp"
 #include "openvino/runtime/compute_hash.hpp"
 #include "openvino/util/hash_util.hpp"
 
 namespace ov::util {
 
+namespace {
+// limits the memory held by the copies of the data waiting to be written
+constexpr size_t max_queued_bytes = 64 * 1024 * 1024;
+// the number of elements converted to fp16 by one task
+constexpr size_t fp16_chunk_elements = 64 * 1024;
+
+template <typename T>
+void convert_to_fp16_in_parallel(const T* src_data, ov::float16* dst_data, size_t count) {
+    const size_t chunks = (count + fp16_chunk_elements - 1) / fp16_chunk_elements;
+    ov::parallel_for(chunks, [&](size_t chunk) {
+        const auto begin = chunk * fp16_chunk_elements;
+        const auto end = std::min(begin + fp16_chunk_elements, count);
+        if constexpr (std::is_same_v<T, float>) {
+            ov::reference::convert_from_f32_to_f16_with_clamp(src_data + begin, dst_data + begin, end - begin);
+        } else {
+            // Reference implementation for fp64 to fp16 conversion
+            for (size_t i = begin; i < end; ++i) {
+                // if abs value is smaller than the smallest positive fp16, but not zero
+                if (std::abs(src_data[i]) < ov::float16::from_bits(0x0001) && src_data[i] != 0.0f) {
+                    dst_data[i] = 0;
+                } else if (src_data[i] > std::numeric_limits<ov::float16>::max()) {
+                    dst_data[i] = std::numeric_limits<ov::float16>::max();
+                } else if (src_data[i] < std::numeric_limits<ov::float16>::lowest()) {
+                    dst_data[i] = std::numeric_limits<ov::float16>::lowest();
+                } else {
+                    dst_data[i] = static_cast<ov::float16>(src_data[i]);
+                }
+            }
+        }
+    });
+}
+}  // namespace
+
+// Writes the data to the stream in a background thread, so the hashing and the fp16 conversion of the next constants
+// overlap with the disk writes. The data is written in the order it was queued, so the output is the same as with
+// the direct writes.
+class ConstantWriter::WriteBehind {
+public:
+    WriteBehind(std::ostream& stream, FilePosition position) : m_stream(stream), m_position(position) {
+        m_thread = std::thread([this] {
+            run();
+        });
+    }
+
+    ~WriteBehind() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+
+    FilePosition get_position() const {
+        return m_position;
+    }
+
+    void push(const char* data, size_t size, std::shared_ptr<const void> owner) {
+        const size_t queued_size = owner ? size : 0;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // a single block larger than the limit is queued anyway
+        m_cv.wait(lock, [&] {
+            return m_error || m_queued_bytes == 0 || m_queued_bytes + queued_size <= max_queued_bytes;
+        });
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+        m_queue.push_back({data, size, queued_size, std::move(owner)});
+        m_queued_bytes += queued_size;
+        m_position += static_cast<FilePosition>(size);
+        lock.unlock();
+        m_cv.notify_all();
+    }
+
+    void flush() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [&] {
+            return m_queue.empty() && !m_writing;
+        });
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+private:
+    struct Block {
+        const char* data;
+        size_t size;
+        size_t queued_size;
+        std::shared_ptr<const void> owner;  // keeps the temporary data alive until it is written
+    };
+
+    void run() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_cv.wait(lock, [&] {
+                return m_stop || !m_queue.empty();
+            });
+            if (m_queue.empty()) {
+                return;
+            }
+            auto block = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_writing = true;
+            const bool failed = static_cast<bool>(m_error);
+            lock.unlock();
+
+            std::exception_ptr error;
+            if (!failed) {
+                try {
+                    m_stream.write(block.data, block.size);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            }
+            block.owner.reset();
+
+            lock.lock();
+            if (error) {
+                m_error = error;
+            }
+            m_queued_bytes -= block.queued_size;
+            m_writing = false;
+            m_cv.notify_all();
+        }
+    }
+
+    std::ostream& m_stream;
+    FilePosition m_position;  // the position after the queued data, accessed by the producer only
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Block> m_queue;
+    size_t m_queued_bytes = 0;
+    bool m_writing = false;
+    bool m_stop = false;
+    std::exception_ptr m_error;
+    std::thread m_thread;
+};
+
 ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression)
     : m_hash_to_file_positions{},
       m_binary_output(bin_data),
       m_enable_compression(enable_compression),
       m_blob_offset(bin_data.tellp()),
-      m_data_hash{} {}
+      m_data_hash{} {
+    // the offsets are tracked by the writer, so the stream has to report its position to start from
+    if (m_blob_offset >= 0) {
+        m_write_behind = std::make_shared<WriteBehind>(bin_data, m_blob_offset);
+    }
+}
 
 ConstantWriter::~ConstantWriter() = default;
 
+void ConstantWriter::flush() {
+    if (m_write_behind) {
+        m_write_behind->flush();
+    }
+}
+
+ConstantWriter::FilePosition ConstantWriter::get_write_position() const {
+    return m_write_behind ? m_write_behind->get_position() : static_cast<FilePosition>(m_binary_output.get().tellp());
+}
+
+void ConstantWriter::write_data(const char* ptr, size_t size, std::shared_ptr<const void> owner) {
+    if (m_write_behind) {
+        m_write_behind->push(ptr, size, std::move(owner));
+    } else {
+        m_binary_output.get().write(ptr, size);
+    }
+}
+
 ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
                                                    size_t size,
                                                    size_t& new_size,
                                                    bool compress_to_fp16,
                                                    ov::element::Type src_type,
                                                    bool ptr_is_temporary) {
-    const FilePosition write_pos = m_binary_output.get().tellp();
+    const FilePosition write_pos = get_write_position();
     const auto offset = write_pos - m_blob_offset;
     new_size = size;
 
-    const auto fp16_data = compress_to_fp16 ? compress_data_to_fp16(ptr, size, src_type, new_size) : nullptr;
+    auto fp16_data = compress_to_fp16 ? compress_data_to_fp16(ptr, size, src_type, new_size) : nullptr;
     const auto data_ptr = compress_to_fp16 ? fp16_data.get() : ptr;
 
     if (m_enable_compression) {
@@ -57,7 +225,15 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
         // fast hash (skip data)
         m_data_hash = util::u64_hash_combine(m_data_hash, new_size);
     }
-    m_binary_output.get().write(data_ptr, new_size);
+    if (fp16_data) {
+        write_data(data_ptr, new_size, std::shared_ptr<const char[]>(std::move(fp16_data)));
+    } else if (ptr_is_temporary && m_write_behind) {
+        // the temporary data may be released before the write-behind thread reaches it
+        auto copy = std::make_shared<std::vector<char>>(ptr, ptr + size);
+        write_data(copy->data(), size, copy);
+    } else {
+        write_data(data_ptr, new_size, nullptr);
+    }
     return offset;
 }
 
@@ -83,20 +259,30 @@ ConstantWriter::FilePosition ConstantWriter::write(const std::vector<std::string
         }
 
         // Cache miss: store the packed buffer so its pointer stays valid for future memcmp
-        m_packed_string_data.push_back(std::move(tmp));
-        const char* stable_ptr = m_packed_string_data.back().data();
-        const FilePosition write_pos = m_binary_output.get().tellp();
+        m_packed_string_data.push_back(std::make_shared<std::vector<char>>(std::move(tmp)));
+        const auto& packed = m_packed_string_data.back();
+        const char* stable_ptr = packed->data();
+        const FilePosition write_pos = get_write_position();
         const FilePosition offset = write_pos - m_blob_offset;
         m_hash_to_file_positions.insert({hash, {offset, static_cast<const void*>(stable_ptr)}});
         m_data_hash = util::u64_hash_combine(m_data_hash, hash);
-        m_binary_output.get().write(stable_ptr, new_size);
+        write_data(stable_ptr, new_size, packed);
         return offset;
     } else {
-        const FilePosition write_pos = m_binary_output.get().tellp();
+        const FilePosition write_pos = get_write_position();
         const FilePosition offset = write_pos - m_blob_offset;
         m_data_hash = util::u64_hash_combine(m_data_hash, new_size);
-        for (const auto& sv : chunks)
-            m_binary_output.get().write(sv.data(), sv.size());
+        if (m_write_behind) {
+            // the chunks refer to the temporary data of the string tensor
+            auto packed = std::make_shared<std::vector<char>>();
+            packed->reserve(new_size);
+            for (const auto& sv : chunks)
+                packed->insert(packed->end(), sv.begin(), sv.end());
+            write_data(packed->data(), new_size, packed);
+        } else {
+            for (const auto& sv : chunks)
+                m_binary_output.get().write(sv.data(), sv.size());
+        }
         return offset;
     }
 }
@@ -113,26 +299,13 @@ std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
         auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
         auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
         auto src_data = reinterpret_cast<const float*>(ptr);
-        ov::reference::convert_from_f32_to_f16_with_clamp(src_data, dst_data, num_src_elements);
+        convert_to_fp16_in_parallel(src_data, dst_data, num_src_elements);
         return new_ptr;
     } else if (src_type == ov::element::f64) {
         auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
         auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
         auto src_data = reinterpret_cast<const double*>(ptr);
-
-        // Reference implementation for fp64 to fp16 conversion
-        for (size_t i = 0; i < num_src_elements; ++i) {
-            // if abs value is smaller than the smallest positive fp16, but not zero
-            if (std::abs(src_data[i]) < ov::float16::from_bits(0x0001) && src_data[i] != 0.0f) {
-                dst_data[i] = 0;
-            } else if (src_data[i] > std::numeric_limits<ov::float16>::max()) {
-                dst_data[i] = std::numeric_limits<ov::float16>::max();
-            } else if (src_data[i] < std::numeric_limits<ov::float16>::lowest()) {
-                dst_data[i] = std::numeric_limits<ov::float16>::lowest();
-            } else {
-                dst_data[i] = static_cast<ov::float16>(src_data[i]);
-            }
-        }
+        convert_to_fp16_in_parallel(src_data, dst_data, num_src_elements);
         return new_ptr;
     } else {
         OPENVINO_THROW("[ INTERNAL ERROR ] Not supported source type for weights compression: ", src_type);
@@ -16,6 +16,8 @@
 #include "openvino/pass/backward_graph_rewrite.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -269,6 +271,59 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
 }
 
+class ApplyLogPass : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("ApplyLogPass");
+    ApplyLogPass(const std::shared_ptr<Node>& root, std::vector<std::string>& log)
+        : MatcherPass("ApplyLogPass",
+                      std::make_shared<ov::pass::pattern::Matcher>(root, "ApplyLogMatcher"),
+                      [root, &log](const std::shared_ptr<Node>& node) {
+                          log.push_back(root->get_friendly_name() + ":" + node->get_type_name());
+                          return false;
+                      }) {}
+};
+
+TEST(GraphRewriteTest, HybridMatcherPassDispatch) {
+    auto f = get_model();
+
+    std::vector<std::string> log;
+    auto typed = std::make_shared<op::v1::Divide>(pattern::any_input(), pattern::any_input());
+    typed->set_friendly_name("typed");
+    auto untyped = pattern::any_input();
+    untyped->set_friendly_name("untyped");
+    auto multi_type = pattern::wrap_type<op::v0::Relu, op::v0::Parameter>();
+    multi_type->set_friendly_name("multi_type");
+    auto or_root = std::make_shared<pattern::op::Or>(
+        OutputVector{pattern::wrap_type<op::v0::Constant>(), pattern::wrap_type<op::v0::Parameter>()});
+    or_root->set_friendly_name("or");
+    auto label_root = std::make_shared<pattern::op::Label>(element::dynamic,
+                                                           PartialShape::dynamic(),
+                                                           pattern::consumers_count(1),
+                                                           OutputVector{pattern::wrap_type<op::v1::Divide>()});
+    label_root->set_friendly_name("label");
+
+    Anchor anchor;
+    anchor.add_matcher<ApplyLogPass>(typed, log);
+    anchor.add_matcher<ApplyLogPass>(untyped, log);
+    anchor.add_matcher<ApplyLogPass>(multi_type, log);
+    anchor.add_matcher<ApplyLogPass>(or_root, log);
+    anchor.add_matcher<ApplyLogPass>(label_root, log);
+    anchor.run_on_model(f);
+
+    // the typed matchers are run for the nodes of their types only and in order of the registration with the untyped
+    // ones
+    const std::vector<std::string> expected{"untyped:Parameter",
+                                            "multi_type:Parameter",
+                                            "or:Parameter",
+                                            "untyped:Constant",
+                                            "or:Constant",
+                                            "typed:Divide",
+                                            "untyped:Divide",
+                                            "label:Divide",
+                                            "untyped:Result"};
+    ASSERT_EQ(expected, log);
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_model();
@@ -4158,4 +4158,108 @@ TEST(constant_folding, loop_with_node_which_has_no_evaluate) {
     EXPECT_NO_THROW(pass::ConstantFolding().run_on_model(model));
     EXPECT_EQ(count_ops_of_type<op::v5::Loop>(model), 1);
 }
+
+TEST(constant_folding, independent_subgraphs) {
+    constexpr size_t num_chains = 16;
+    ResultVector results;
+    for (size_t i = 0; i < num_chains; i++) {
+        const auto suffix = std::to_string(i);
+        const auto value = static_cast<uint8_t>(i);
+        auto weights = op::v0::Constant::create(element::u8, Shape{4}, std::vector<uint8_t>(4, value));
+        weights->set_friendly_name("weights_" + suffix);
+        auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+        convert->set_friendly_name("convert_" + suffix);
+        auto zero_point = op::v0::Constant::create(element::f32, Shape{}, {1.0f});
+        zero_point->set_friendly_name("zero_point_" + suffix);
+        auto subtract = make_shared<op::v1::Subtract>(convert, zero_point);
+        subtract->set_friendly_name("subtract_" + suffix);
+        auto scale = op::v0::Constant::create(element::f32, Shape{}, {2.0f});
+        scale->set_friendly_name("scale_" + suffix);
+        auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+        multiply->set_friendly_name("test_" + suffix);
+        results.push_back(make_shared<op::v0::Result>(multiply));
+    }
+    auto model = make_shared<Model>(results, ParameterVector{});
+
+    run_constant_folding(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Subtract>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    for (size_t i = 0; i < num_chains; i++) {
+        const auto suffix = std::to_string(i);
+        auto new_const = get_result_constant(model, i);
+        ASSERT_TRUE(new_const);
+        check_names(new_const,
+                    {"weights_" + suffix,
+                     "convert_" + suffix,
+                     "zero_point_" + suffix,
+                     "subtract_" + suffix,
+                     "scale_" + suffix,
+                     "test_" + suffix},
+                    "test_" + suffix);
+        const auto expected = (static_cast<float>(i) - 1.0f) * 2.0f;
+        range_test_check(new_const->cast_vector<float>(), std::vector<float>(4, expected));
+    }
+}
+
+TEST(constant_folding, independent_subgraphs_with_shared_nodes) {
+    // every subgraph has an intermediate node shared by two sinks, one of them consumed by a non-foldable node
+    constexpr size_t num_subgraphs = 8;
+    ResultVector results;
+    ParameterVector params;
+    for (size_t i = 0; i < num_subgraphs; i++) {
+        const auto suffix = std::to_string(i);
+        const auto value = static_cast<uint8_t>(i);
+        auto weights = op::v0::Constant::create(element::u8, Shape{4}, std::vector<uint8_t>(4, value));
+        weights->set_friendly_name("weights_" + suffix);
+        auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+        convert->set_friendly_name("convert_" + suffix);
+        auto shift = op::v0::Constant::create(element::f32, Shape{}, {1.0f});
+        shift->set_friendly_name("shift_" + suffix);
+        auto add = make_shared<op::v1::Add>(convert, shift);
+        add->set_friendly_name("add_" + suffix);
+        auto scale = op::v0::Constant::create(element::f32, Shape{}, {2.0f});
+        scale->set_friendly_name("scale_" + suffix);
+        auto multiply = make_shared<op::v1::Multiply>(add, scale);
+        multiply->set_friendly_name("multiply_" + suffix);
+        auto param = make_shared<op::v0::Parameter>(element::f32, Shape{4});
+        auto subtract = make_shared<op::v1::Subtract>(param, add);
+        results.push_back(make_shared<op::v0::Result>(multiply));
+        results.push_back(make_shared<op::v0::Result>(subtract));
+        params.push_back(param);
+    }
+    auto model = make_shared<Model>(results, params);
+
+    run_constant_folding(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Subtract>(model), num_subgraphs);
+    for (size_t i = 0; i < num_subgraphs; i++) {
+        const auto suffix = std::to_string(i);
+        const auto expected = static_cast<float>(i) + 1.0f;
+
+        auto multiply_const = get_result_constant(model, 2 * i);
+        ASSERT_TRUE(multiply_const);
+        check_names(multiply_const,
+                    {"weights_" + suffix,
+                     "convert_" + suffix,
+                     "shift_" + suffix,
+                     "add_" + suffix,
+                     "scale_" + suffix,
+                     "multiply_" + suffix},
+                    "multiply_" + suffix);
+        range_test_check(multiply_const->cast_vector<float>(), std::vector<float>(4, expected * 2.0f));
+
+        auto add_const = ov::as_type_ptr<op::v0::Constant>(
+            model->get_results().at(2 * i + 1)->get_input_node_ptr(0)->get_input_node_shared_ptr(1));
+        ASSERT_TRUE(add_const);
+        check_names(add_const,
+                    {"weights_" + suffix, "convert_" + suffix, "shift_" + suffix, "add_" + suffix},
+                    "add_" + suffix);
+        range_test_check(add_const->cast_vector<float>(), std::vector<float>(4, expected));
+    }
+}
 }  // namespace ov::test
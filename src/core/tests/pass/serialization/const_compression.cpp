@@ -5,12 +5,15 @@
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <sstream>
 
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/graph_comparator.hpp"
 #include "common_test_utils/test_common.hpp"
 #include "openvino/pass/serialize.hpp"
+#include "openvino/reference/convert.hpp"
 #include "openvino/runtime/core.hpp"
+#include "openvino/xml_util/constant_writer.hpp"
 #include "transformations/common_optimizations/compress_float_constants.hpp"
 
 class SerializationConstantCompressionTest : public ov::test::TestsCommon {
@@ -444,3 +447,48 @@ TEST_F(SerializationConstantCompressionTest, IdenticalStringConstantsRoundTrip)
         }
     }
 }
+
+TEST_F(SerializationConstantCompressionTest, ConstantWriterOutputMatchesSequentialWrites) {
+    // large enough to be converted to fp16 by several tasks
+    std::vector<float> weights(3 * 64 * 1024 + 5);
+    for (size_t i = 0; i < weights.size(); ++i) {
+        weights[i] = static_cast<float>(i % 1000) * 100.5f - 5000.f;
+    }
+    std::vector<float> other(weights.rbegin(), weights.rend());
+    const auto weights_ptr = reinterpret_cast<const char*>(weights.data());
+    const auto weights_size = weights.size() * sizeof(float);
+
+    std::stringstream bin;
+    const std::string header = "header";
+    bin.write(header.data(), header.size());
+    ov::util::ConstantWriter writer(bin);
+
+    size_t new_size = 0;
+    EXPECT_EQ(writer.write(weights_ptr, weights_size, new_size), 0);
+    EXPECT_EQ(new_size, weights_size);
+    {
+        auto temporary = other;
+        EXPECT_EQ(writer.write(reinterpret_cast<const char*>(temporary.data()),
+                               weights_size,
+                               new_size,
+                               false,
+                               ov::element::dynamic,
+                               true),
+                  static_cast<int64_t>(weights_size));
+        std::fill(temporary.begin(), temporary.end(), 0.f);
+    }
+    // the duplicate is not written
+    EXPECT_EQ(writer.write(weights_ptr, weights_size, new_size), 0);
+    EXPECT_EQ(writer.write(weights_ptr, weights_size, new_size, true, ov::element::f32),
+              static_cast<int64_t>(2 * weights_size));
+    EXPECT_EQ(new_size, weights.size() * sizeof(ov::float16));
+    writer.flush();
+
+    std::vector<ov::float16> weights_fp16(weights.size());
+    ov::reference::convert_from_f32_to_f16_with_clamp(weights.data(), weights_fp16.data(), weights.size());
+    std::string expected = header;
+    expected.append(weights_ptr, weights_size);
+    expected.append(reinterpret_cast<const char*>(other.data()), weights_size);
+    expected.append(reinterpret_cast<const char*>(weights_fp16.data()), weights_fp16.size() * sizeof(ov::float16));
+    ASSERT_EQ(bin.str(), expected);
+}
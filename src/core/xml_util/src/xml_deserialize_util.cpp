@@ -4,6 +4,7 @@
 
 #include "openvino/xml_util/xml_deserialize_util.hpp"
 
+#include <exception>
 #include <regex>
 #include <stack>
 #include <string_view>
@@ -11,6 +12,7 @@
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/memory_util.hpp"
 #include "openvino/core/meta_data.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
@@ -167,6 +169,16 @@ struct GenericLayerParams {
     std::vector<LayerPortData> inputPorts;
     std::vector<LayerPortData> outputPorts;
 
+    // runtime info of the layer and its ports, read ahead of the node creation (IR v11+)
+    struct RuntimeInfo {
+        ov::RTMap node;
+        std::vector<ov::RTMap> outputs;
+        std::vector<ov::RTMap> inputs;
+        // thrown on the node creation, if the runtime info is malformed
+        std::exception_ptr error;
+    };
+    RuntimeInfo rtInfo;
+
     size_t get_real_input_port_id(size_t id) const {
         size_t real_id = 0;
         for (auto& it : inputPorts) {
@@ -406,6 +418,64 @@ private:
     pugi::xml_node m_node;
 };
 
+namespace {
+
+void read_runtime_info(ov::pass::Attributes& attrs_factory, RTMap& rt_info, const pugi::xml_node& rt_attrs) {
+    if (!rt_attrs)
+        return;
+    for (const auto& item : rt_attrs) {
+        std::string attribute_name, attribute_version;
+        if (std::strcmp(item.name(), "attribute") == 0 && getStrAttribute(item, "name", attribute_name) &&
+            getStrAttribute(item, "version", attribute_version)) {
+            const auto& type_info = ov::DiscreteTypeInfo(attribute_name.c_str(), attribute_version.c_str());
+            auto attr = attrs_factory.create_by_type_info(type_info);
+            if (!attr.empty()) {
+                if (attr.is<ov::RuntimeAttribute>()) {
+                    RTInfoDeserializer attribute_visitor(item);
+                    if (attr.as<ov::RuntimeAttribute>().visit_attributes(attribute_visitor)) {
+                        auto res = rt_info.emplace(type_info, attr);
+                        if (!res.second) {
+                            OPENVINO_THROW("multiple rt_info attributes are detected: ", attribute_name);
+                        }
+                    } else {
+                        OPENVINO_THROW("VisitAttributes is not supported for: ", item.name(), " attribute");
+                    }
+                } else {
+                    OPENVINO_THROW("Attribute: ", item.name(), " is not recognized as runtime attribute");
+                }
+            } else {
+                // As runtime attributes are optional, so we skip attribute if it is unknown to avoid exception
+                // when loading new IR with new attribute in old OV version.
+            }
+        }
+    }
+
+    set_custom_rt_info(rt_attrs, rt_info);
+}
+
+GenericLayerParams::RuntimeInfo read_layer_runtime_info(const pugi::xml_node& node) {
+    GenericLayerParams::RuntimeInfo rt_info;
+    ov::pass::Attributes attrs_factory;
+    read_runtime_info(attrs_factory, rt_info.node, node.child("rt_info"));
+    FOREACH_CHILD (rt_node, node.child("output"), "port") {
+        read_runtime_info(attrs_factory, rt_info.outputs.emplace_back(), rt_node.child("rt_info"));
+    }
+    FOREACH_CHILD (rt_node, node.child("input"), "port") {
+        read_runtime_info(attrs_factory, rt_info.inputs.emplace_back(), rt_node.child("rt_info"));
+    }
+    return rt_info;
+}
+
+void merge_runtime_info(RTMap& rt_info, const RTMap& parsed) {
+    for (const auto& [name, attr] : parsed) {
+        if (!rt_info.emplace(name, attr).second && attr.is<ov::RuntimeAttribute>()) {
+            OPENVINO_THROW("multiple rt_info attributes are detected: ", name);
+        }
+    }
+}
+
+}  // namespace
+
 XmlDeserializer::XmlDeserializer(const pugi::xml_node& node,
                                  const std::shared_ptr<ov::AlignedBuffer>& weights,
                                  const std::unordered_map<std::string, ov::OpSet>& opsets,
@@ -944,10 +1014,34 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
-    // Read all layers and store their parameters in params map
+    // Read all layers and store their parameters in params map. The layers are not connected yet, so their
+    // attributes and runtime info are read in parallel, only the graph is built sequentially
+    std::vector<pugi::xml_node> layers;
     FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parse_generic_params(node);
-        params[node_param.layerId] = {node, node_param};
+        layers.push_back(node);
+    }
+    std::vector<GenericLayerParams> layer_params(layers.size());
+    std::vector<std::exception_ptr> layer_errors(layers.size());
+    ov::parallel_for(layers.size(), [&](size_t i) {
+        try {
+            layer_params[i] = parse_generic_params(layers[i]);
+        } catch (...) {
+            layer_errors[i] = std::current_exception();
+            return;
+        }
+        if (m_version > 10) {
+            try {
+                layer_params[i].rtInfo = read_layer_runtime_info(layers[i]);
+            } catch (...) {
+                layer_params[i].rtInfo.error = std::current_exception();
+            }
+        }
+    });
+    for (size_t i = 0; i < layers.size(); ++i) {
+        if (layer_errors[i]) {
+            std::rethrow_exception(layer_errors[i]);
+        }
+        auto& node_param = layer_params[i];
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -958,6 +1052,8 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
             order.push_back(node_param.layerId);
             edges[node_param.layerId] = {};
         }
+        const auto layer_id = node_param.layerId;
+        params[layer_id] = {layers[i], std::move(node_param)};
     }
 
     // Read all edges and store them for further usage
@@ -1343,63 +1439,23 @@ std::shared_ptr<ov::Node> XmlDeserializer::create_node(const std::vector<ov::Out
             ovNode->get_output_tensor(i).set_names(params.outputPorts[i].names);
     }
 
-    ov::pass::Attributes attrs_factory;
-    auto set_runtime_info = [&attrs_factory](RTMap& rt_info, const pugi::xml_node& rt_attrs) {
-        if (!rt_attrs)
-            return;
-        for (const auto& item : rt_attrs) {
-            std::string attribute_name, attribute_version;
-            if (std::strcmp(item.name(), "attribute") == 0 && getStrAttribute(item, "name", attribute_name) &&
-                getStrAttribute(item, "version", attribute_version)) {
-                const auto& type_info = ov::DiscreteTypeInfo(attribute_name.c_str(), attribute_version.c_str());
-                auto attr = attrs_factory.create_by_type_info(type_info);
-                if (!attr.empty()) {
-                    if (attr.is<ov::RuntimeAttribute>()) {
-                        RTInfoDeserializer attribute_visitor(item);
-                        if (attr.as<ov::RuntimeAttribute>().visit_attributes(attribute_visitor)) {
-                            auto res = rt_info.emplace(type_info, attr);
-                            if (!res.second) {
-                                OPENVINO_THROW("multiple rt_info attributes are detected: ", attribute_name);
-                            }
-                        } else {
-                            OPENVINO_THROW("VisitAttributes is not supported for: ", item.name(), " attribute");
-                        }
-                    } else {
-                        OPENVINO_THROW("Attribute: ", item.name(), " is not recognized as runtime attribute");
-                    }
-                } else {
-                    // As runtime attributes are optional, so we skip attribute if it is unknown to avoid exception
-                    // when loading new IR with new attribute in old OV version.
-                }
-            }
-        }
-
-        set_custom_rt_info(rt_attrs, rt_info);
-    };
-
     // read runtime info only for IR v11+
     if (m_version > 10) {
+        const auto& rt_info = params.rtInfo;
+        if (rt_info.error) {
+            std::rethrow_exception(rt_info.error);
+        }
         // set node runtime info attributes
-        set_runtime_info(ovNode->get_rt_info(), node.child("rt_info"));
+        merge_runtime_info(ovNode->get_rt_info(), rt_info.node);
 
         // set output ports runtime info attributes
-        auto out_node = node.child("output");
-        if (!out_node.empty()) {
-            size_t index{0};
-            FOREACH_CHILD (rt_node, out_node, "port") {
-                set_runtime_info(ovNode->output(index).get_rt_info(), rt_node.child("rt_info"));
-                ++index;
-            }
+        for (size_t index = 0; index < rt_info.outputs.size(); ++index) {
+            merge_runtime_info(ovNode->output(index).get_rt_info(), rt_info.outputs[index]);
         }
 
         // set input ports runtime info attributes
-        auto in_node = node.child("input");
-        if (!in_node.empty()) {
-            size_t index{0};
-            FOREACH_CHILD (rt_node, in_node, "port") {
-                set_runtime_info(ovNode->input(index).get_rt_info(), rt_node.child("rt_info"));
-                ++index;
-            }
+        for (size_t index = 0; index < rt_info.inputs.size(); ++index) {
+            merge_runtime_info(ovNode->input(index).get_rt_info(), rt_info.inputs[index]);
         }
 
         // If IR has no information about dedicated output names for Result node (model output),
@@ -118,6 +118,9 @@ public:
     // dequant / repacking / requantization, so the decoder never builds OV nodes itself. (Model
     // inputs are also GGML_OP_NONE leaves, but they are returned via get_model_inputs() and
     // resolved to Parameters before the walk, so they carry no "data".)
+    // A weight may also expose get_attribute<bool>("requantize") = false to keep Q5_K/Q6_K (and
+    // token_embd/output) in their native K-quant sub-block layout rather than requantizing them to
+    // channel-wise Q8_0_C; absent means true.
 
     // RoPE configuration, exposed through get_attribute<RopeConfig>("rope_config"):
     //   - at model scope (via InputModel::get_rope_config), used by TranslateSession::preprocess
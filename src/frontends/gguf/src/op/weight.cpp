@@ -28,6 +28,9 @@ OutputVector translate_weight(const NodeContext& context) {
     auto data = context.get_attribute<ov::Tensor>("data");
     FRONT_END_OP_CONVERSION_CHECK(data, "GGML_OP_NONE node has no 'data' attribute; not a weight");
     auto quant_type = context.get_attribute<std::string>("quant_type");
+    // Optional: the decoder may keep K-quant weights in their native sub-block layout instead of
+    // requantizing them to channel-wise Q8_0_C (see make_weight_node).
+    const bool requantize = context.get_attribute<bool>("requantize", true);
     auto shape = context.get_output_shape().to_shape();
 
     // MoE MXFP4 expert weights stay PACKED: MUL_MAT_ID gathers the selected expert and dequantizes
@@ -54,14 +57,14 @@ OutputVector translate_weight(const NodeContext& context) {
     if (shape.size() > 2) {
         const size_t cols = shape.back();
         const size_t rows = std::accumulate(shape.begin(), shape.end() - 1, size_t{1}, std::multiplies<size_t>());
-        auto node = make_weight_node(data, quant_type, ov::Shape{rows, cols}, context.get_name());
+        auto node = make_weight_node(data, quant_type, ov::Shape{rows, cols}, context.get_name(), requantize);
         std::vector<int64_t> full(shape.begin(), shape.end());
         auto target = ov::op::v0::Constant::create(ov::element::i64, {full.size()}, full);
         auto reshaped = std::make_shared<ov::op::v1::Reshape>(node, target, false);
         return rename_outputs_with_suffix({reshaped}, context.get_name());
     }
 
-    auto node = make_weight_node(data, quant_type, shape, context.get_name());
+    auto node = make_weight_node(data, quant_type, shape, context.get_name(), requantize);
     return rename_outputs_with_suffix({node}, context.get_name());
 }
 
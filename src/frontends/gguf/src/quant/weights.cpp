@@ -3,19 +3,21 @@
 //
 
 // Weight node construction for the native GGUF path. Quantized weights become a
-// low-bitness compressed decompression subgraph (u4 for 4-bit, u8 for 8-bit; OpenVINO
-// supports every GGUF bitness used here except 3-bit). Adapted from the genai gguf_utils
+// low-bitness compressed decompression subgraph (u2 for 2-bit, u4/i4 for 4-bit, i8 for 5..8-bit;
+// 3-bit Q3_K is widened to i4 as the plugins decompress no 3-bit type). Adapted from the genai gguf_utils
 // make_int4/int8_weights helpers, working from the parser's compressed tensors
 // (.weight u32-packed + .scales f16 + .biases f16).
 
 #include "weights.hpp"
 
 #include <cctype>
+#include <chrono>
 #include <cmath>
 #include <cstring>
 #include <vector>
 
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/decompositions/low_precision_dequantize.hpp"
 #include "openvino/op/constant.hpp"
@@ -26,6 +28,7 @@
 #include "openvino/op/subtract.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/util/log.hpp"
 
 namespace ov {
 namespace frontend {
@@ -311,83 +314,95 @@ static std::shared_ptr<ov::Node> build_q8_0_c_node(ov::Tensor weights, ov::Tenso
     return std::make_shared<ov::op::v0::Convert>(scaled, ov::element::f32);
 }
 
-// Legacy path: requant from an already-materialized f32 weight vector (used for token_embd/output
-// when the type has no faithful per-row dequant, and for any non-K requant source).
-std::shared_ptr<ov::Node> requantize_q8_0_channelwise(const std::vector<float>& x, size_t rows, size_t cols) {
+// Read-only view of the gguf_fill_* output (i8, i4, u2, or u32-packed u4 weights + per-group f16
+// scale and optional f16 zero-point) that dequantizes one row at a time: f32 = (w - zp) * scale,
+// grouped along cols.
+class ExtractedWeightRows {
+public:
+    ExtractedWeightRows(const std::unordered_map<std::string, ov::Tensor>& w, const std::string& base, size_t cols)
+        : m_weight(get(w, base + ".weight")),
+          m_scales(get(w, base + ".scales").data<ov::float16>()),
+          m_num_groups(get(w, base + ".scales").get_shape().back()),
+          m_group(cols / m_num_groups),
+          m_cols(cols) {
+        if (auto zp_it = w.find(base + ".zp"); zp_it != w.end()) {
+            m_zp = zp_it->second.data<ov::float16>();
+        }
+    }
+
+    void dequant_row(size_t r, float* y) const {
+        const ov::float16* s = m_scales + r * m_num_groups;
+        const ov::float16* z = m_zp ? m_zp + r * m_num_groups : nullptr;
+        const auto emit = [&](size_t c, float qval) {
+            const size_t g = c / m_group;
+            const float zpf = z ? static_cast<float>(z[g]) : 0.0f;
+            y[c] = (qval - zpf) * static_cast<float>(s[g]);
+        };
+        const auto et = m_weight.get_element_type();
+        if (et == ov::element::i8) {
+            const auto* q = m_weight.data<int8_t>() + r * m_cols;
+            for (size_t c = 0; c < m_cols; ++c)
+                emit(c, static_cast<float>(q[c]));
+        } else if (et == ov::element::u2) {
+            // Q2_K: u2 weights, 4 per byte LSB-first, raw [0..3] with a zero-point.
+            const auto* bytes = static_cast<const uint8_t*>(m_weight.data()) + r * (m_cols / 4);
+            for (size_t c = 0; c < m_cols; ++c)
+                emit(c, static_cast<float>((bytes[c / 4] >> ((c % 4) * 2)) & 0x3));
+        } else {
+            // u32-packed 4-bit, 8 nibbles per u32. With a zero-point (Q4_1/Q4_K) the nibbles are
+            // unsigned u4; without one (Q4_0 XOR-encoded, Q3_K centered) they are signed i4.
+            const bool signed_u4 = m_zp == nullptr;
+            const auto* packed = static_cast<const uint32_t*>(m_weight.data()) + r * (m_cols / 8);
+            for (size_t c = 0; c < m_cols; ++c) {
+                const uint8_t nib = (packed[c / 8] >> ((c % 8) * 4)) & 0xF;
+                emit(c,
+                     signed_u4 ? static_cast<float>(nib < 8 ? static_cast<int>(nib) : static_cast<int>(nib) - 16)
+                               : static_cast<float>(nib));
+            }
+        }
+    }
+
+private:
+    const ov::Tensor& m_weight;
+    const ov::float16* m_scales;
+    const ov::float16* m_zp = nullptr;
+    size_t m_num_groups;
+    size_t m_group;
+    size_t m_cols;
+};
+
+// Non-K requant path (token_embd/output of a type with no faithful per-row dequant, e.g. Q4_0 /
+// Q8_0): dequantize the extracted tensors and re-quantize to channel-wise Q8_0_C row by row
+// in parallel. Like requantize_q8_0_channelwise_faithful this streams through a per-thread `cols`
+// scratch, so the full f32 weight (4 bytes per element of the largest tensor in the model) is never
+// materialized.
+std::shared_ptr<ov::Node> requantize_extracted_q8_0_channelwise(const std::unordered_map<std::string, ov::Tensor>& w,
+                                                                const std::string& base,
+                                                                size_t rows,
+                                                                size_t cols) {
+    const ExtractedWeightRows src(w, base, cols);
     ov::Tensor weights(ov::element::i8, ov::Shape{rows, cols});
     ov::Tensor scales(ov::element::f16, ov::Shape{rows, 1});
-    auto* w = weights.data<int8_t>();
+    auto* q = weights.data<int8_t>();
     auto* s = scales.data<ov::float16>();
-    for (size_t r = 0; r < rows; ++r) {
+    ov::parallel_for(rows, [&](size_t r) {
+        thread_local std::vector<float> rowf;
+        rowf.resize(cols);
+        src.dequant_row(r, rowf.data());
         float amax = 0.0f;
         for (size_t c = 0; c < cols; ++c) {
-            amax = std::max(amax, std::fabs(x[r * cols + c]));
+            amax = std::max(amax, std::fabs(rowf[c]));
         }
         const float d = amax / 127.0f;
         const float id = d ? 1.0f / d : 0.0f;
         s[r] = ov::float16(d);
         for (size_t c = 0; c < cols; ++c) {
-            w[r * cols + c] = static_cast<int8_t>(std::lround(x[r * cols + c] * id));
+            q[r * cols + c] = static_cast<int8_t>(std::lround(rowf[c] * id));
         }
-    }
+    });
     return build_q8_0_c_node(weights, scales, rows, cols);
 }
 
-// Dequantize the gguf_fill_* output (i8, i4, u2, or u32-packed u4 weights + per-group f16 scale
-// and optional f16 zero-point) to row-major f32: f32 = (w - zp) * scale, grouped along cols.
-std::vector<float> dequant_extracted_to_f32(const std::unordered_map<std::string, ov::Tensor>& w,
-                                            const std::string& base,
-                                            size_t rows,
-                                            size_t cols) {
-    const ov::Tensor& weight = get(w, base + ".weight");
-    const ov::Tensor& scales = get(w, base + ".scales");
-    const size_t num_groups = scales.get_shape().back();
-    const size_t group = cols / num_groups;
-    const auto* s = scales.data<ov::float16>();
-
-    auto zp_it = w.find(base + ".zp");
-    const bool has_zp = zp_it != w.end();
-    const ov::float16* z = has_zp ? zp_it->second.data<ov::float16>() : nullptr;
-
-    const auto et = weight.get_element_type();
-    std::vector<float> out(rows * cols);
-    const auto emit = [&](size_t r, size_t c, float qval) {
-        size_t g = r * num_groups + c / group;
-        float zpf = z ? static_cast<float>(z[g]) : 0.0f;
-        out[r * cols + c] = (qval - zpf) * static_cast<float>(s[g]);
-    };
-    if (et == ov::element::i8) {
-        const auto* q = weight.data<int8_t>();
-        for (size_t r = 0; r < rows; ++r)
-            for (size_t c = 0; c < cols; ++c)
-                emit(r, c, static_cast<float>(q[r * cols + c]));
-    } else if (et == ov::element::u2) {
-        // Q2_K: u2 weights, 4 per byte LSB-first, raw [0..3] with a zero-point.
-        const auto* bytes = static_cast<const uint8_t*>(weight.data());
-        const size_t per_row_bytes = cols / 4;
-        for (size_t r = 0; r < rows; ++r)
-            for (size_t c = 0; c < cols; ++c) {
-                uint8_t v = (bytes[r * per_row_bytes + c / 4] >> ((c % 4) * 2)) & 0x3;
-                emit(r, c, static_cast<float>(v));
-            }
-    } else {
-        // u32-packed 4-bit, 8 nibbles per u32. With a zero-point (Q4_1/Q4_K) the nibbles are
-        // unsigned u4; without one (Q4_0 XOR-encoded, Q3_K centered) they are signed i4.
-        const bool signed_u4 = !has_zp;
-        const auto* packed = static_cast<const uint32_t*>(weight.data());
-        const size_t per_row_u32 = cols / 8;
-        for (size_t r = 0; r < rows; ++r)
-            for (size_t c = 0; c < cols; ++c) {
-                uint32_t word = packed[r * per_row_u32 + c / 8];
-                uint8_t nib = (word >> ((c % 8) * 4)) & 0xF;
-                float qval = signed_u4 ? static_cast<float>(nib < 8 ? static_cast<int>(nib) : static_cast<int>(nib) - 16)
-                                       : static_cast<float>(nib);
-                emit(r, c, qval);
-            }
-    }
-    return out;
-}
-
 // Decide whether a weight is requantized to Q8_0_C, mirroring llama.cpp's
 // ggml_openvino_get_requant_type for the CPU/GPU (non-NPU) path.
 bool needs_q8_0_c_requant(const std::string& name, gguf_tensor_type qtype) {
@@ -397,6 +412,39 @@ bool needs_q8_0_c_requant(const std::string& name, gguf_tensor_type qtype) {
     return qtype == GGUF_TYPE_Q6_K || qtype == GGUF_TYPE_Q5_K;
 }
 
+// Load-time breakdown of one weight: "repack" is the extraction / requantization of the raw GGUF
+// bytes into OV-native tensors, "build" is the construction of the decompression subgraph on top
+// of them. Reported at the debug log level when the weight is done.
+class WeightLoadTimer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    WeightLoadTimer(const std::string& name, const std::string& quant_type, size_t bytes)
+        : m_name(name),
+          m_quant_type(quant_type),
+          m_bytes(bytes),
+          m_start(Clock::now()),
+          m_repacked(m_start) {}
+
+    void repacked() {
+        m_repacked = Clock::now();
+    }
+
+    ~WeightLoadTimer() {
+        using ms = std::chrono::duration<double, std::milli>;
+        const auto end = Clock::now();
+        OPENVINO_DEBUG("[ggml] weight '", m_name, "' (", m_quant_type, ", ", m_bytes, " bytes): repack ",
+                       ms(m_repacked - m_start).count(), " ms, build ", ms(end - m_repacked).count(), " ms");
+    }
+
+private:
+    const std::string& m_name;
+    const std::string& m_quant_type;
+    size_t m_bytes;
+    Clock::time_point m_start;
+    Clock::time_point m_repacked;
+};
+
 }  // namespace
 
 std::shared_ptr<ov::Node> make_weight_node(const std::string& base,
@@ -483,7 +531,8 @@ gguf_tensor_type gguf_type_from_name(const std::string& quant_type) {
 std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
                                            const std::string& quant_type,
                                            const ov::Shape& logical_shape,
-                                           const std::string& name) {
+                                           const std::string& name,
+                                           bool requantize) {
     OPENVINO_ASSERT(logical_shape.size() == 2,
                     "[ggml] weight logical shape must be 2D [rows, cols], got rank ",
                     logical_shape.size());
@@ -492,6 +541,7 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
     const gguf_tensor_type qtype = gguf_type_from_name(quant_type);
 
     const std::string base = "weight";
+    WeightLoadTimer timer(name, quant_type, data.get_byte_size());
 
     // Non-quantized weights: wrap the bytes directly as a Constant of the matching type.
     if (qtype == GGUF_TYPE_F32 || qtype == GGUF_TYPE_F16 || qtype == GGUF_TYPE_BF16) {
@@ -529,9 +579,12 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
     // the original ggml-openvino backend. The legacy Q4_1/Q5_1/Q2_K types keep a faithful f16 zp:
     // they are not perf-critical here, and their zp = -min/scale can fall outside u8 range. The
     // requant path (token_embd/output) also keeps f16 -- its dequant feeds channel-wise Q8_0_C.
-    const bool requant = needs_q8_0_c_requant(name, qtype);
-    const ov::element::Type zp_type =
-        (!requant && qtype == GGUF_TYPE_Q4_K) ? ov::element::u8 : ov::element::f16;
+    // With requantization disabled by the decoder, Q5_K/Q6_K keep their own sub-block grouping
+    // (Q6_K: exact i8 + group-16 scales; Q5_K: group-32 sub-blocks with the exact f16
+    // zp = dmin*m / (d*sc), as rounding it to u8 would cost the accuracy the native layout is kept
+    // for) and run through the plugin's compressed-weights FullyConnected as is.
+    const bool requant = requantize && needs_q8_0_c_requant(name, qtype);
+    const ov::element::Type zp_type = (!requant && qtype == GGUF_TYPE_Q4_K) ? ov::element::u8 : ov::element::f16;
 
     // K-quant requant sources: the fused dequant -> Q8_0_C streams from the raw bytes, so skip the
     // full-tensor gguf_fill_* extraction below (it would be discarded) and return before the switch.
@@ -541,6 +594,7 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
         bool ok = requantize_q8_0_channelwise_faithful(tensor, rows, cols, qtype, rq_weights.data<int8_t>(),
                                                        rq_scales.data<ov::float16>());
         OPENVINO_ASSERT(ok, "[ggml] faithful K-quant requant failed for ", base);
+        timer.repacked();
         return build_q8_0_c_node(rq_weights, rq_scales, rows, cols);
     }
 
@@ -622,12 +676,14 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
 
     // Non-K requant sources (e.g. an F16 / Q4_0 / Q8_0 token_embd or output): the K-quant fast path
     // above already handled Q4_K/Q5_K/Q6_K, so here reproduce the backend's channel-wise Q8_0_C by
-    // dequantizing to f32 from the extracted tensors, then re-quantizing.
+    // dequantizing the extracted tensors row by row, then re-quantizing.
     if (requant) {
-        auto f32 = dequant_extracted_to_f32(w, base, rows, cols);
-        return requantize_q8_0_channelwise(f32, rows, cols);
+        auto node = requantize_extracted_q8_0_channelwise(w, base, rows, cols);
+        timer.repacked();
+        return node;
     }
 
+    timer.repacked();
     return make_weight_node(base, w, q);
 }
 
@@ -40,10 +40,14 @@ std::shared_ptr<ov::Node> make_weight_node(const std::string& base,
 // `name` is the gguf tensor name (e.g. "token_embd.weight", "blk.0.ffn_down.weight"). It is
 // used to decide channel-wise requantization to Q8_0_C for the embedding / output / Q6_K /
 // Q5_K tensors, matching the llama.cpp ggml-openvino backend's CPU/GPU weight pipeline.
+// `requantize` = false disables that requantization: the weights then keep their sub-block
+// scales (and exact f16 zero-points) and are consumed by the plugin's compressed-weights
+// FullyConnected directly, without the requant round-off.
 std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
                                            const std::string& quant_type,
                                            const ov::Shape& logical_shape,
-                                           const std::string& name = "");
+                                           const std::string& name = "",
+                                           bool requantize = true);
 
 // Map a ggml quant type name (e.g. "Q4_K") to its gguf_tensor_type id. Throws if unknown.
 gguf_tensor_type gguf_type_from_name(const std::string& quant_type);
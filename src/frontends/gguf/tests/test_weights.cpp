@@ -91,6 +91,79 @@ INSTANTIATE_TEST_SUITE_P(AllQuantTypes,
                              return std::string(i.param.stem);
                          });
 
+class GGUFRequantWeight : public ::testing::TestWithParam<WeightCase> {};
+
+// token_embd / output weights of a non-K type are dequantized from the extracted tensors and
+// requantized to channel-wise Q8_0_C row by row; the result must still track ggml's to_float.
+TEST_P(GGUFRequantWeight, MatchesGgmlToFloat) {
+    const WeightCase c = GetParam();
+    const auto qbytes = load_npy<uint8_t>(std::string(c.stem) + "_qbytes");
+    const auto ref = load_npy<float>(std::string(c.stem) + "_deq");
+    ASSERT_EQ(ref.size(), kRows * kCols);
+
+    auto model = SingleOpBuilder()
+                     .op("GGML_OP_NONE")
+                     .output("token_embd.weight", ov::element::f32, {kRows, kCols})
+                     .attr<ov::Tensor>("data", bytes_to_u8_tensor(qbytes))
+                     .attr<std::string>("quant_type", c.quant_type)
+                     .build();
+
+    auto out = run_on_cpu(model, {});
+    ASSERT_EQ(out.get_size(), ref.size());
+
+    const float* a = out.data<float>();
+    float max_diff = 0.f;
+    for (size_t i = 0; i < ref.size(); ++i)
+        max_diff = std::max(max_diff, std::fabs(a[i] - ref[i]));
+    EXPECT_LE(max_diff, c.tol) << c.stem << ": requantized weight diverges from ggml to_float";
+}
+
+INSTANTIATE_TEST_SUITE_P(NonKQuantTypes,
+                         GGUFRequantWeight,
+                         ::testing::Values(WeightCase{"q4_0", "Q4_0", kTolRequant},
+                                           WeightCase{"q4_1", "Q4_1", kTolRequant},
+                                           WeightCase{"q8_0", "Q8_0", kTolRequant},
+                                           WeightCase{"q2_k", "Q2_K", kTolRequant}),
+                         [](const ::testing::TestParamInfo<WeightCase>& i) {
+                             return std::string(i.param.stem);
+                         });
+
+class GGUFNativeKQuantWeight : public ::testing::TestWithParam<WeightCase> {};
+
+// With "requantize" = false the K-quant weights keep their sub-block scales instead of going
+// through channel-wise Q8_0_C: Q6_K becomes exact, Q5_K keeps its exact fractional zp.
+TEST_P(GGUFNativeKQuantWeight, MatchesGgmlToFloat) {
+    const WeightCase c = GetParam();
+    const auto qbytes = load_npy<uint8_t>(std::string(c.stem) + "_qbytes");
+    const auto ref = load_npy<float>(std::string(c.stem) + "_deq");
+    ASSERT_EQ(ref.size(), kRows * kCols);
+
+    auto model = SingleOpBuilder()
+                     .op("GGML_OP_NONE")
+                     .output("w", ov::element::f32, {kRows, kCols})
+                     .attr<ov::Tensor>("data", bytes_to_u8_tensor(qbytes))
+                     .attr<std::string>("quant_type", c.quant_type)
+                     .attr<bool>("requantize", false)
+                     .build();
+
+    auto out = run_on_cpu(model, {});
+    ASSERT_EQ(out.get_size(), ref.size());
+
+    const float* a = out.data<float>();
+    float max_diff = 0.f;
+    for (size_t i = 0; i < ref.size(); ++i)
+        max_diff = std::max(max_diff, std::fabs(a[i] - ref[i]));
+    EXPECT_LE(max_diff, c.tol) << c.stem << ": native K-quant weight diverges from ggml to_float";
+}
+
+INSTANTIATE_TEST_SUITE_P(KQuantTypes,
+                         GGUFNativeKQuantWeight,
+                         ::testing::Values(WeightCase{"q5_k", "Q5_K", kTolFaithful},
+                                           WeightCase{"q6_k", "Q6_K", kTolFaithful}),
+                         [](const ::testing::TestParamInfo<WeightCase>& i) {
+                             return std::string(i.param.stem);
+                         });
+
 // An F16 weight is wrapped directly as a constant (no dequant); round-trips the raw bytes.
 TEST(GGUFWeightPlain, F16) {
     std::vector<ov::float16> vals{1.0f, -2.0f, 3.5f, -4.25f, 0.0f, 7.0f};
@@ -4,10 +4,21 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <sstream>
 #include <string>
 #include <thread>
 
+#include "common_test_utils/graph_comparator.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
 #include "openvino/openvino.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+#include "transformations/rt_info/fused_names_attribute.hpp"
 
 class IRFRThreadingTests : public ::testing::Test {
 public:
@@ -145,3 +156,82 @@ TEST_F(IRFRThreadingTests, get_meta_data_in_different_threads) {
         EXPECT_EQ(it->second.as<std::string>(), "False");
     });
 }
+
+TEST_F(IRFRThreadingTests, parallel_and_serial_deserialization_are_equal) {
+    // enough layers with the runtime info on the nodes and the ports for the layers to be read in parallel
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 3, 8, 8});
+    param->get_rt_info()["user_key"] = std::string("input");
+    param->output(0).get_rt_info()["port_key"] = std::string("input_port");
+    ov::Output<ov::Node> last = param;
+    for (size_t i = 0; i < 64; ++i) {
+        const auto suffix = std::to_string(i);
+        auto constant = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1}, {static_cast<float>(i)});
+        auto add = std::make_shared<ov::op::v1::Add>(last, constant);
+        auto relu = std::make_shared<ov::op::v0::Relu>(add);
+        relu->set_friendly_name("relu_" + suffix);
+        relu->get_rt_info()[ov::FusedNames::get_type_info_static()] = ov::FusedNames("relu_" + suffix);
+        relu->get_rt_info()["user_key"] = "relu_" + suffix;
+        relu->input(0).get_rt_info()["port_key"] = "relu_in_" + suffix;
+        relu->output(0).get_rt_info()["port_key"] = "relu_out_" + suffix;
+        last = relu;
+    }
+    auto result = std::make_shared<ov::op::v0::Result>(last);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+    std::stringstream xml_stream, bin_stream;
+    ov::pass::Serialize(xml_stream, bin_stream).run_on_model(model);
+    const auto xml = xml_stream.str();
+    const auto bin = bin_stream.str();
+    ov::Tensor weights(ov::element::u8, ov::Shape{bin.size()});
+    std::memcpy(weights.data(), bin.data(), bin.size());
+
+    const auto parallel = core.read_model(xml, weights);
+    // a single-threaded stream makes the parallel sections of the deserialization run serially
+    std::shared_ptr<ov::Model> serial;
+    ov::threading::CPUStreamsExecutor executor{ov::threading::IStreamsExecutor::Config{"IRFRSerialReader", 1, 1}};
+    executor.run_and_wait({[&] {
+        serial = core.read_model(xml, weights);
+    }});
+    ASSERT_NE(nullptr, serial);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::RUNTIME_KEYS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(parallel, serial);
+    ASSERT_TRUE(res.valid) << res.message;
+
+    const auto check_value = [](const ov::RTMap& actual, const ov::RTMap& expected, const std::string& key) {
+        ASSERT_EQ(expected.count(key), actual.count(key)) << key;
+        if (expected.count(key)) {
+            EXPECT_EQ(expected.at(key).as<std::string>(), actual.at(key).as<std::string>()) << key;
+        }
+    };
+    const auto parallel_ops = parallel->get_ordered_ops();
+    const auto serial_ops = serial->get_ordered_ops();
+    ASSERT_EQ(serial_ops.size(), parallel_ops.size());
+    size_t checked_relu = 0;
+    for (size_t i = 0; i < serial_ops.size(); ++i) {
+        const auto& actual = parallel_ops[i];
+        const auto& expected = serial_ops[i];
+        ASSERT_EQ(expected->get_friendly_name(), actual->get_friendly_name());
+        check_value(actual->get_rt_info(), expected->get_rt_info(), "user_key");
+        EXPECT_EQ(ov::getFusedNamesVector(expected), ov::getFusedNamesVector(actual)) << actual->get_friendly_name();
+        for (size_t port = 0; port < expected->get_input_size(); ++port) {
+            check_value(actual->input(port).get_rt_info(), expected->input(port).get_rt_info(), "port_key");
+        }
+        for (size_t port = 0; port < expected->get_output_size(); ++port) {
+            check_value(actual->output(port).get_rt_info(), expected->output(port).get_rt_info(), "port_key");
+        }
+        if (ov::is_type<ov::op::v0::Relu>(actual)) {
+            const auto suffix = actual->get_friendly_name().substr(std::string("relu_").size());
+            EXPECT_EQ("relu_" + suffix, actual->get_rt_info().at("user_key").as<std::string>());
+            EXPECT_EQ("relu_in_" + suffix, actual->input(0).get_rt_info().at("port_key").as<std::string>());
+            EXPECT_EQ("relu_out_" + suffix, actual->output(0).get_rt_info().at("port_key").as<std::string>());
+            ++checked_relu;
+        }
+    }
+    EXPECT_EQ(64, checked_relu);
+}
@@ -17,6 +17,7 @@
 #include "onnx_framework_node.hpp"
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/frontend/onnx/extension/conversion.hpp"
 #include "openvino/frontend/onnx/node_context.hpp"
@@ -112,25 +113,59 @@ Graph::Graph(const std::filesystem::path& model_dir,
 
     std::map<std::string, Tensor> initializers;
 
-    // Process all initializers in the graph
+    // Embedded raw data is referenced in the ModelProto only when mmap is enabled, as it is for external data
+    const auto data_owner = m_mmap_cache ? std::shared_ptr<const ModelProto>{model_proto} : nullptr;
+    const auto make_initializer = [&](const TensorProto& initializer_tensor) {
+        Tensor tensor = Tensor{initializer_tensor, m_model_dir, m_mmap_cache, data_owner};
+        std::shared_ptr<ov::op::v0::Constant> ov_constant;
+        try {
+            ov_constant = tensor.get_ov_constant();
+        } catch (const error::invalid_external_data&) {
+            // invalid external data makes initializers creation impossible
+            throw;
+        } catch (const ov::Exception&) {
+            ov_constant = ov::frontend::onnx::common::make_failsafe_constant(tensor.get_ov_type());
+        }
+        return ov_constant;
+    };
+
+    std::vector<const TensorProto*> initializer_tensors;
     for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor, m_model_dir, m_mmap_cache};
-            std::shared_ptr<ov::op::v0::Constant> ov_constant;
-            // For each initializer create a Constant node and store it in cache
-            try {
-                ov_constant = tensor.get_ov_constant();
-            } catch (const error::invalid_external_data&) {
-                // invalid external data makes initializers creation impossible
-                throw;
-            } catch (const ov::Exception&) {
-                ov_constant = ov::frontend::onnx::common::make_failsafe_constant(tensor.get_ov_type());
-            }
+            initializer_tensors.push_back(&initializer_tensor);
+        }
+    }
 
-            initializers.emplace(initializer_tensor.name(), tensor);
-            ov_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
-            m_cache->emplace_node(initializer_tensor.name(), std::move(ov_constant));
+    // Constants are created from the initializers in parallel, the external data ones are left for the sequential
+    // pass below because they share the mmap cache
+    std::vector<std::shared_ptr<ov::op::v0::Constant>> ov_constants(initializer_tensors.size());
+    std::vector<std::exception_ptr> errors(initializer_tensors.size());
+    ov::parallel_for(initializer_tensors.size(), [&](size_t i) {
+        const auto& initializer_tensor = *initializer_tensors[i];
+        if (initializer_tensor.has_data_location() &&
+            initializer_tensor.data_location() == TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL) {
+            return;
+        }
+        try {
+            ov_constants[i] = make_initializer(initializer_tensor);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+
+    // Process all initializers in the graph
+    for (size_t i = 0; i < initializer_tensors.size(); ++i) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
         }
+        const auto& initializer_tensor = *initializer_tensors[i];
+        // For each initializer create a Constant node and store it in cache
+        auto ov_constant = ov_constants[i] ? std::move(ov_constants[i]) : make_initializer(initializer_tensor);
+
+        initializers.emplace(initializer_tensor.name(),
+                             Tensor{initializer_tensor, m_model_dir, m_mmap_cache, data_owner});
+        ov_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
+        m_cache->emplace_node(initializer_tensor.name(), std::move(ov_constant));
     }
 
     // Process all ONNX graph inputs, convert them to OV nodes and store in cache
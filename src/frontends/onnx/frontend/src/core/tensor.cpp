@@ -5,6 +5,7 @@
 #include "core/tensor.hpp"
 
 #include "input_model.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/file_util.hpp"
 
 namespace ov {
@@ -462,6 +463,14 @@ std::shared_ptr<ov::op::v0::Constant> Tensor::get_ov_constant() const {
         if (element_count == 0 && constant_buffer) {
             element_count = constant_buffer->size() * 8 / ov_type.bitwidth();
         }
+    } else if (m_model_proto != nullptr && m_tensor_proto != nullptr && m_tensor_proto->has_raw_data() &&
+               ov_type != ov::element::string) {
+        // raw_data already has the layout of the Constant, so the Constant refers to it inside the ModelProto
+        const auto& raw_data = m_tensor_proto->raw_data();
+        constant_buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<const ModelProto>>>(
+            const_cast<char*>(raw_data.data()),
+            raw_data.size(),
+            m_model_proto);
     }
 
     if (element_count != shape_elements && !(element_count == 0 && m_shape.empty())) {
@@ -479,6 +488,9 @@ std::shared_ptr<ov::op::v0::Constant> Tensor::get_ov_constant() const {
         try {
             constant = std::make_shared<ov::op::v0::Constant>(ov_type, m_shape, constant_buffer);
         } catch (const ov::Exception&) {
+            if (!external_data_valid) {
+                throw;
+            }
             throw error::invalid_external_data(
                 "The size of the external data file does not match the byte size of an initializer '" + get_name() +
                 "' in the model");
@@ -28,6 +28,7 @@ namespace ov {
 namespace frontend {
 namespace onnx {
 
+using ::ONNX_NAMESPACE::ModelProto;
 using ::ONNX_NAMESPACE::TensorProto;
 using ::ONNX_NAMESPACE::TensorProto_DataLocation;
 using ::ONNX_NAMESPACE::TensorProto_DataType;
@@ -188,12 +189,18 @@ public:
     };
 
     Tensor() = delete;
-    Tensor(const TensorProto& tensor, const std::filesystem::path& model_dir, detail::MappedMemoryHandles mmap_cache)
+    /// \param model_proto The ModelProto which owns the tensor. When it is set, embedded raw data is not copied
+    ///                    and the Constant keeps the ModelProto alive instead.
+    Tensor(const TensorProto& tensor,
+           const std::filesystem::path& model_dir,
+           detail::MappedMemoryHandles mmap_cache,
+           std::shared_ptr<const ModelProto> model_proto = nullptr)
         : m_tensor_proto{&tensor},
           m_tensor_place(nullptr),
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
           m_model_dir{model_dir},
-          m_mmap_cache{mmap_cache} {
+          m_mmap_cache{mmap_cache},
+          m_model_proto{std::move(model_proto)} {
         if (m_shape == ov::Shape{0} && get_data_size() == 1) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a ov::Shape{0} stored in m_shape.
@@ -426,6 +433,7 @@ private:
     ov::Shape m_shape;
     std::filesystem::path m_model_dir;
     detail::MappedMemoryHandles m_mmap_cache;
+    std::shared_ptr<const ModelProto> m_model_proto;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
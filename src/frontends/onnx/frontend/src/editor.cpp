@@ -313,6 +313,16 @@ struct ONNXModelEditor::Impl {
         graph_topological_sort(m_model_proto->mutable_graph());
     }
 
+    /// \brief Returns the graph for modification. Constants of already converted models can refer to
+    ///        the initializers of the ModelProto, in such case the editor continues with a copy of it.
+    GraphProto* mutable_graph() {
+        if (m_model_proto.use_count() > 1) {
+            m_model_proto = std::make_shared<ModelProto>(*m_model_proto);
+            m_is_mapper_updated = false;
+        }
+        return m_model_proto->mutable_graph();
+    }
+
     Impl(const std::filesystem::path& model_path) : Impl(std::make_shared<ModelProto>(parse_from_file(model_path))) {}
 
     Impl(std::istream& model_stream) : Impl(std::make_shared<ModelProto>(parse_from_istream(model_stream))) {}
@@ -365,7 +375,7 @@ void ONNXModelEditor::serialize(const std::filesystem::path& out_file_path) cons
 }
 
 void ONNXModelEditor::set_input_types(const std::map<std::string, ov::element::Type_t>& input_types) {
-    auto* onnx_graph = m_pimpl->m_model_proto->mutable_graph();
+    auto* onnx_graph = m_pimpl->mutable_graph();
 
     for (const auto& input_desc : input_types) {
         auto* onnx_input = find_graph_input(*onnx_graph, input_desc.first);
@@ -393,7 +403,7 @@ ov::element::Type_t ONNXModelEditor::get_input_type(const std::string& tensor_na
 }
 
 void ONNXModelEditor::set_input_shapes(const std::map<std::string, ov::PartialShape>& input_shapes) {
-    auto* onnx_graph = m_pimpl->m_model_proto->mutable_graph();
+    auto* onnx_graph = m_pimpl->mutable_graph();
 
     for (const auto& input_desc : input_shapes) {
         auto* onnx_input = find_graph_input(*onnx_graph, input_desc.first);
@@ -454,14 +464,15 @@ void ONNXModelEditor::extract_subgraph(const std::vector<InputEdge>& inputs,
         return;
     }
 
+    auto* onnx_graph = m_pimpl->mutable_graph();
     if (!outputs.empty()) {
-        m_pimpl->m_model_proto->mutable_graph()->mutable_output()->Clear();
+        onnx_graph->mutable_output()->Clear();
     }
 
     InferShapesAutoRelease onnx_shapes(m_pimpl->m_model_proto);
     onnx_shapes.infer_shapes();
 
-    SubgraphExtractor editor{*(m_pimpl->m_model_proto->mutable_graph())};
+    SubgraphExtractor editor{*onnx_graph};
     editor.add_new_inputs(inputs, merge_inputs);
     editor.add_new_outputs(outputs);
     editor.extract_subgraph(outputs);
@@ -539,7 +550,7 @@ std::shared_ptr<Model> ONNXModelEditor::get_function() const {
 
 void ONNXModelEditor::set_input_values(
     const std::map<std::string, std::shared_ptr<ov::op::v0::Constant>>& input_values) {
-    auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
+    auto onnx_graph = m_pimpl->mutable_graph();
 
     for (const auto& input : input_values) {
         auto& name = input.first;
@@ -567,7 +578,7 @@ void ONNXModelEditor::set_input_values(
 void ONNXModelEditor::set_tensor_name(const std::string& current_name, const std::string& new_name) {
     OPENVINO_ASSERT(!new_name.empty(), "New name must not be empty.");
 
-    const auto graph = m_pimpl->m_model_proto->mutable_graph();
+    const auto graph = m_pimpl->mutable_graph();
 
     OPENVINO_ASSERT(!(find_graph_input(*graph, new_name) || find_graph_output(*graph, new_name) ||
                       find_graph_initializer(*graph, new_name) || find_graph_value_info(*graph, new_name) ||
@@ -609,7 +620,7 @@ void ONNXModelEditor::set_tensor_name(const std::string& current_name, const std
 
 void ONNXModelEditor::set_node_name(const EditorNode& node, const std::string& new_name) {
     const auto node_idx = m_pimpl->m_edge_mapper.get_node_index(node);
-    const auto graph = m_pimpl->m_model_proto->mutable_graph();
+    const auto graph = m_pimpl->mutable_graph();
 
     m_pimpl->m_is_mapper_updated = false;
 
@@ -629,7 +640,7 @@ std::string ONNXModelEditor::get_node_name(const EditorNode& node) const {
 }
 
 void ONNXModelEditor::clear_nodes_name(const std::string& name) {
-    const auto graph = m_pimpl->m_model_proto->mutable_graph();
+    const auto graph = m_pimpl->mutable_graph();
 
     m_pimpl->m_is_mapper_updated = false;
 
@@ -645,7 +656,7 @@ void ONNXModelEditor::set_name_for_dimension(const std::string& node_name,
                                              const std::string& dim_name) {
     OPENVINO_ASSERT(!dim_name.empty(), "Dimension name must not be empty.");
 
-    const auto graph = m_pimpl->m_model_proto->mutable_graph();
+    const auto graph = m_pimpl->mutable_graph();
 
     OPENVINO_ASSERT(!find_graph_initializer(*graph, node_name), "ONNX initializer shape dimension cannot be dynamic.");
 
@@ -735,7 +746,7 @@ std::shared_ptr<Model> ONNXModelEditor::decode() {
 }
 
 void ONNXModelEditor::add_output(const OutputEdge& output_edge) const {
-    auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
+    auto onnx_graph = m_pimpl->mutable_graph();
     std::vector<OutputEdge> onnx_output;
     onnx_output.push_back(output_edge);
     SubgraphExtractor editor{*onnx_graph};
@@ -824,6 +824,28 @@ OPENVINO_TEST(onnx_editor, values__modify_one_initializer) {
     test_case.run();
 }
 
+OPENVINO_TEST(onnx_editor, values__modify_initializer_of_converted_model) {
+    SKIP_ONNX_EDITOR_IF_GRAPH_ITERATOR_ENABLED();
+    FrontEnd::Ptr front_end;
+    auto input_model = load_model("model_editor/add_1D_with_initializers.onnx", &front_end);
+
+    auto place = input_model->get_place_by_tensor_name("B");
+    input_model->set_tensor_value(place, std::vector<int64_t>{3, 4}.data());
+    // the raw data of "B" is referenced by the Constant of the first model
+    const auto first_model = front_end->convert(input_model);
+
+    input_model->set_tensor_value(place, std::vector<int64_t>{5, 7}.data());
+    const auto second_model = front_end->convert(input_model);
+
+    auto first_test_case = ov::test::TestCase(first_model);
+    first_test_case.add_expected_output<int64_t>(Shape{2}, {4, 6});
+    first_test_case.run();
+
+    auto second_test_case = ov::test::TestCase(second_model);
+    second_test_case.add_expected_output<int64_t>(Shape{2}, {6, 9});
+    second_test_case.run();
+}
+
 OPENVINO_TEST(onnx_editor, values__modify_two_initializers) {
     SKIP_ONNX_EDITOR_IF_GRAPH_ITERATOR_ENABLED();
     FrontEnd::Ptr front_end;
@@ -45,6 +45,15 @@ public:
      */
     virtual void set_state(const ov::SoPtr<ov::ITensor>& state);
 
+    /**
+     * @brief Sets the new state for the next inference to the value of another state of the same variable,
+     * e.g. to fork the state of one infer request into another one.
+     * The default implementation is equivalent to `set_state(source->get_state())`, while the plugin may share
+     * the source memory by reference and copy it only when either of the states is updated (copy-on-write)
+     * @param source The state to take the value from
+     */
+    virtual void set_state_from(const std::shared_ptr<IVariableState>& source);
+
     /**
      * @brief Returns the value of the variable state.
      * @return The value of the variable state
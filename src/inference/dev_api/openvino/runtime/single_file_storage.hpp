@@ -19,6 +19,8 @@ public:
         String = 0x02,
         Blob = 0x03,
         BlobMap = 0x04,
+        BlobChunks = 0x05,
+        ChunkData = 0x06,
         ConstantMeta = 0x10,
         WeightSource = 0x11,
     };
@@ -67,6 +69,17 @@ public:
 
     static const size_t blob_alignment;
 
+    /**
+     * @brief Content defined chunk of a blob. The blobs are split into chunks by a rolling hash, so the same content
+     * produces the same chunks regardless of its position in the blob. Chunks with the same hash and size are
+     * deduplicated across the entries.
+     */
+    struct ChunkInfo {
+        uint64_t offset;  //!< Absolute position of the chunk data in the file
+        uint64_t size;
+        uint64_t hash;  //!< Hash of the chunk content
+    };
+
 private:
     std::filesystem::path m_file_path;
 
@@ -74,13 +87,19 @@ private:
         uint64_t offset;
         uint64_t size;
         std::string model_name;
+        std::vector<ChunkInfo> chunks;  //!< Empty or contiguous for the blobs stored as a whole
     };
     std::unordered_map<BlobIdType, BlobInfo> m_blob_index;
+    std::unordered_map<uint64_t, std::vector<ChunkInfo>> m_chunk_index;
     std::shared_ptr<wsh::Context> m_shared_context;
     bool build_content_index(std::ifstream& stream);
 
     static BlobIdType convert_blob_id(const std::string& blob_id);
-    void write_blob_entry(std::fstream& stream, BlobIdType blob_id, StreamWriter& writer);
+    std::streampos write_blob_entry(std::fstream& stream, BlobIdType blob_id, StreamWriter& writer);
     bool has_blob_id(BlobIdType blob_id) const;
+    void register_chunks(BlobIdType blob_id, std::vector<ChunkInfo> chunks);
+    std::vector<ChunkInfo> deduplicate_chunks(std::fstream& stream,
+                                              const std::vector<ChunkInfo>& chunks,
+                                              uint64_t data_pos) const;
 };
 }  // namespace ov::runtime
@@ -23,7 +23,8 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from per-stream queues. An idle stream steals the tasks
+ *        queued to the other streams of the same NUMA node, the tasks never move to another node.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -59,6 +60,18 @@ public:
 
     void cpu_reset() override;
 
+    /**
+     * @brief Returns the number of tasks taken from the queue of another stream so far
+     * @return The number of stolen tasks
+     */
+    size_t get_steals_num() const;
+
+    /**
+     * @brief Returns the number of tasks waiting in the stream queues
+     * @return The total queue depth
+     */
+    size_t get_queue_depth() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
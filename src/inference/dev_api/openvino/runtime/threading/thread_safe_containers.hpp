@@ -10,6 +10,7 @@
 #include <mutex>
 #include <queue>
 #include <type_traits>
+#include <vector>
 
 #include "openvino/core/parallel.hpp"
 
@@ -21,29 +22,171 @@
 namespace ov {
 namespace threading {
 
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer FIFO queue.
+ * The queue is a ring of cells, each cell carries a sequence number which tells the producers and the consumers
+ * whether the cell is free to be written or ready to be read at the current lap, so a push or a pop is a single
+ * compare-and-swap of the corresponding position in the common case.
+ * @tparam T The type of the elements, it must be default constructible and move assignable
+ */
+template <typename T>
+class MPMCBoundedQueue {
+public:
+    /**
+     * @brief Constructs the queue
+     * @param capacity The maximum number of the elements, rounded up to a power of two
+     */
+    explicit MPMCBoundedQueue(std::size_t capacity) : _cells(round_up_to_power_of_two(capacity)) {
+        _mask = _cells.size() - 1;
+        for (std::size_t i = 0; i < _cells.size(); ++i) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPMCBoundedQueue(const MPMCBoundedQueue&) = delete;
+    MPMCBoundedQueue& operator=(const MPMCBoundedQueue&) = delete;
+
+    /**
+     * @brief Pushes the element to the queue
+     * @param value The element, it is moved from only if the push succeeded
+     * @return false if the queue is full
+     */
+    bool try_push(T& value) {
+        auto pos = _enqueue_pos.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        _published.fetch_add(1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pops the oldest element from the queue
+     * @param value The popped element
+     * @return false if the queue is empty
+     */
+    bool try_pop(T& value) {
+        auto pos = _dequeue_pos.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        _published.fetch_sub(1, std::memory_order_relaxed);
+        value = std::move(cell->data);
+        // the queue must not keep the resources of the popped element alive
+        cell->data = T{};
+        cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Returns the number of the published elements, the cells claimed by the pushes in progress are not counted.
+     * @note The elements are popped in the order their cells were claimed, so a published element may still wait
+     * behind an element which push is in progress, i.e. try_pop may fail for a moment even if size() is not zero.
+     */
+    std::size_t size() const {
+        // a pop may claim an element before its producer counts it, so the counter can be negative for a moment
+        const auto published = _published.load(std::memory_order_acquire);
+        return published > 0 ? static_cast<std::size_t>(published) : 0;
+    }
+
+    std::size_t capacity() const {
+        return _cells.size();
+    }
+
+private:
+    static constexpr std::size_t cache_line_size = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        T data{};
+    };
+
+    static std::size_t round_up_to_power_of_two(std::size_t value) {
+        std::size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    std::vector<Cell> _cells;
+    std::size_t _mask = 0;
+    alignas(cache_line_size) std::atomic<std::size_t> _enqueue_pos{0};
+    alignas(cache_line_size) std::atomic<std::size_t> _dequeue_pos{0};
+    alignas(cache_line_size) std::atomic<std::ptrdiff_t> _published{0};
+};
+
+/**
+ * @brief Unbounded multi-producer multi-consumer FIFO queue.
+ * The elements go through the lock-free ring while it has room, the mutex protected overflow queue is used only when
+ * the ring is full. Once some elements are in the overflow queue the new elements follow them there, so the order
+ * of the elements pushed by a thread is kept.
+ */
 template <typename T>
 class ThreadSafeQueueWithSize {
 public:
+    static constexpr std::size_t default_ring_capacity = 256;
+
+    explicit ThreadSafeQueueWithSize(std::size_t ring_capacity = default_ring_capacity) : _ring(ring_capacity) {}
+
     void push(T value) {
+        if (_overflow_size.load(std::memory_order_acquire) == 0 && _ring.try_push(value)) {
+            return;
+        }
         std::lock_guard<std::mutex> lock(_mutex);
         _queue.push(std::move(value));
+        _overflow_size.fetch_add(1, std::memory_order_release);
     }
     bool try_pop(T& value) {
+        if (_ring.try_pop(value)) {
+            return true;
+        }
+        if (_overflow_size.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
         std::lock_guard<std::mutex> lock(_mutex);
         if (!_queue.empty()) {
             value = std::move(_queue.front());
             _queue.pop();
+            _overflow_size.fetch_sub(1, std::memory_order_release);
             return true;
         } else {
             return false;
         }
     }
     size_t size() {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _queue.size();
+        return _ring.size() + _overflow_size.load(std::memory_order_acquire);
     }
 
 protected:
+    MPMCBoundedQueue<T> _ring;
+    std::atomic<std::size_t> _overflow_size{0};
     std::queue<T> _queue;
     std::mutex _mutex;
 };
@@ -74,6 +74,15 @@ public:
      * @param state The current state to set.
      */
     void set_state(const Tensor& state);
+
+    /**
+     * @brief Sets the new state for the next inference to the value of another state of the same variable.
+     * It allows to fork the state of one infer request into another one, e.g. to reuse a common prompt prefix.
+     * Unlike `set_state(source.get_state())`, the plugin may share the source state memory by reference
+     * and copy it only when either of the states is updated.
+     * @param source The state to take the value from.
+     */
+    void set_state(const VariableState& source);
 };
 
 }  // namespace ov
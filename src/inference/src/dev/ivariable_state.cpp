@@ -22,6 +22,11 @@ void ov::IVariableState::set_state(const ov::SoPtr<ov::ITensor>& state) {
     m_state = state;
 }
 
+void ov::IVariableState::set_state_from(const std::shared_ptr<ov::IVariableState>& source) {
+    OPENVINO_ASSERT(source, "Source variable state is not initialized");
+    set_state(source->get_state());
+}
+
 ov::SoPtr<ov::ITensor> ov::IVariableState::get_state() const {
     return m_state;
 }
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -267,6 +268,18 @@ struct CPUStreamsExecutor::Impl {
         int _ncpus = 0;
 #endif
     };
+    // The FIFO of the tasks submitted to a stream, the other streams of the same NUMA node steal from it when idle
+    struct WorkerQueue {
+        std::mutex _mutex;
+        std::deque<Task> _tasks;
+        std::atomic<size_t> _size{0};
+        std::atomic<int> _numaNodeId{0};
+        std::atomic<bool> _waiting{false};  // the stream waits for the tasks, set under Impl::_mutex
+        std::condition_variable _condVar;
+    };
+    // the executor and the stream (queue) index of the current stream thread
+    static thread_local std::pair<const Impl*, size_t> t_worker;
+
     // if the thread is created by CPUStreamsExecutor, the Impl::Stream of the thread is stored by tbb Class
     // enumerable_thread_specific, the alias is ThreadLocal, the limitations of ThreadLocal please refer to
     // https://spec.oneapi.io/versions/latest/elements/oneTBB/source/thread_local_storage/enumerable_thread_specific_cls.html
@@ -396,34 +409,150 @@ struct CPUStreamsExecutor::Impl {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
                 _cpu_ids_all.insert(_cpu_ids_all.end(), processor_ids[streamId].begin(), processor_ids[streamId].end());
             }
+            _workerQueues.emplace_back(new WorkerQueue);
+        }
+        for (auto streamId = 0; streamId < streams_num; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
-                    Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
+                t_worker = {this, static_cast<size_t>(streamId)};
+                auto& queue = *_workerQueues[streamId];
+                {
+                    const auto numaNodeId = _streams->local()->_numaNodeId;
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    queue._numaNodeId = numaNodeId;
+                    ++_readyQueues;
+                }
+                _readyCondVar.notify_one();
+                for (;;) {
+                    Task task = Pop(streamId);
                     if (task) {
                         Execute(task, *(_streams->local()));
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    while (!_isStopped && !HasTasksFor(streamId)) {
+                        // the waker resets the flag, so the other tasks wake up the other streams
+                        queue._waiting = true;
+                        queue._condVar.wait(lock);
+                    }
+                    queue._waiting = false;
+                    if (_isStopped && !HasTasksFor(streamId)) {
+                        break;
                     }
                 }
+                t_worker = {};
             });
         }
+        // the queues must know the NUMA nodes of their streams before any task is queued
+        std::unique_lock<std::mutex> lock(_mutex);
+        _readyCondVar.wait(lock, [&] {
+            return _readyQueues == _workerQueues.size();
+        });
     }
 
+    // A task submitted from a stream thread stays in the stream's own queue, otherwise it goes to the least loaded
+    // queue, so the tasks spread over the NUMA nodes evenly.
     void Enqueue(Task task) {
+        size_t target = 0;
+        if (t_worker.first == this) {
+            target = t_worker.second;
+        } else {
+            const auto queues = _workerQueues.size();
+            const auto start = _nextQueue.fetch_add(1, std::memory_order_relaxed) % queues;
+            target = start;
+            for (size_t i = 1; i < queues && _workerQueues[target]->_size.load(std::memory_order_relaxed) > 0; ++i) {
+                const auto candidate = (start + i) % queues;
+                if (_workerQueues[candidate]->_size.load(std::memory_order_relaxed) <
+                    _workerQueues[target]->_size.load(std::memory_order_relaxed)) {
+                    target = candidate;
+                }
+            }
+        }
         {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            auto& queue = *_workerQueues[target];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            queue._tasks.emplace_back(std::move(task));
+            queue._size.fetch_add(1, std::memory_order_release);
+        }
+        // The waiters check the queues under this mutex, so the wake-up can't be lost. A single idle stream is woken
+        // up, preferably the target one, then any of the same NUMA node. When the node has no idle stream, the task
+        // waits for a stream of the node to finish its current task.
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto numaNodeId = _workerQueues[target]->_numaNodeId.load(std::memory_order_relaxed);
+        WorkerQueue* waiter = _workerQueues[target]->_waiting ? _workerQueues[target].get() : nullptr;
+        for (size_t i = 0; i < _workerQueues.size() && !waiter; ++i) {
+            if (_workerQueues[i]->_waiting &&
+                _workerQueues[i]->_numaNodeId.load(std::memory_order_relaxed) == numaNodeId) {
+                waiter = _workerQueues[i].get();
+            }
+        }
+        if (waiter) {
+            // the next task wakes up another stream
+            waiter->_waiting = false;
+            waiter->_condVar.notify_one();
+        }
+    }
+
+    // The stream takes the tasks of the queues of its own NUMA node only, so the tasks never cross the sockets and
+    // keep working on the node-local weights.
+    bool CanTakeFrom(size_t victim, size_t streamId) const {
+        return _workerQueues[victim]->_numaNodeId.load(std::memory_order_relaxed) ==
+               _workerQueues[streamId]->_numaNodeId.load(std::memory_order_relaxed);
+    }
+
+    bool HasTasksFor(size_t streamId) const {
+        for (size_t i = 0; i < _workerQueues.size(); ++i) {
+            if (_workerQueues[i]->_size.load(std::memory_order_acquire) > 0 && CanTakeFrom(i, streamId)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static Task PopFront(WorkerQueue& queue) {
+        std::lock_guard<std::mutex> lock(queue._mutex);
+        if (queue._tasks.empty()) {
+            return {};
+        }
+        Task task = std::move(queue._tasks.front());
+        queue._tasks.pop_front();
+        queue._size.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    }
+
+    // Takes the oldest task of the own queue, otherwise steals the oldest task of the most loaded queue of the same
+    // NUMA node.
+    Task Pop(size_t streamId) {
+        if (auto task = PopFront(*_workerQueues[streamId])) {
+            return task;
+        }
+        for (;;) {
+            size_t victim = streamId;
+            size_t victimSize = 0;
+            for (size_t i = 0; i < _workerQueues.size(); ++i) {
+                const auto size = _workerQueues[i]->_size.load(std::memory_order_acquire);
+                if (i == streamId || size <= victimSize || !CanTakeFrom(i, streamId)) {
+                    continue;
+                }
+                victim = i;
+                victimSize = size;
+            }
+            if (victimSize == 0) {
+                return {};
+            }
+            if (auto task = PopFront(*_workerQueues[victim])) {
+                _steals.fetch_add(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+    }
+
+    size_t QueueDepth() const {
+        size_t depth = 0;
+        for (const auto& queue : _workerQueues) {
+            depth += queue->_size.load(std::memory_order_relaxed);
         }
-        _queueCondVar.notify_one();
+        return depth;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -491,9 +620,12 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+    std::atomic<size_t> _nextQueue{0};
+    std::atomic<size_t> _steals{0};
+    size_t _readyQueues = 0;
     std::mutex _mutex;
-    std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    std::condition_variable _readyCondVar;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     std::shared_ptr<CustomThreadLocal> _streams;
@@ -505,6 +637,8 @@ struct CPUStreamsExecutor::Impl {
 CPUStreamsExecutor::Impl::CustomThreadLocal::ThreadCleaner::ResourceKeeper
     CPUStreamsExecutor::Impl::CustomThreadLocal::ThreadCleaner::global_resource_holder;
 
+thread_local std::pair<const CPUStreamsExecutor::Impl*, size_t> CPUStreamsExecutor::Impl::t_worker{nullptr, 0};
+
 int CPUStreamsExecutor::get_stream_id() {
     if (!_impl->_streams->find_thread_id()) {
         return 0;
@@ -538,6 +672,14 @@ std::vector<int> CPUStreamsExecutor::get_rank() {
     return stream->_rank;
 }
 
+size_t CPUStreamsExecutor::get_steals_num() const {
+    return _impl->_steals.load(std::memory_order_relaxed);
+}
+
+size_t CPUStreamsExecutor::get_queue_depth() const {
+    return _impl->QueueDepth();
+}
+
 void CPUStreamsExecutor::cpu_reset() {
     {
         std::lock_guard<std::mutex> lock(_impl->_cpu_ids_mutex);
@@ -554,8 +696,10 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
     {
         std::lock_guard<std::mutex> lock(_impl->_mutex);
         _impl->_isStopped = true;
+        for (auto& queue : _impl->_workerQueues) {
+            queue->_condVar.notify_all();
+        }
     }
-    _impl->_queueCondVar.notify_all();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -4,6 +4,10 @@
 
 #include "openvino/runtime/single_file_storage.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/mmap_object.hpp"
@@ -66,6 +70,176 @@ void write_padding(std::ostream& stream, uint64_t alignment) {
         stream.write(padding.data(), padding.size());
     }
 }
+
+using ChunkInfo = SingleFileStorage::ChunkInfo;
+
+// Content defined chunking parameters, the average chunk size is about min_chunk_size + 1 MiB.
+constexpr uint64_t min_chunk_size = 256 * 1024;
+constexpr uint64_t max_chunk_size = 4 * 1024 * 1024;
+constexpr uint64_t chunk_boundary_mask = (uint64_t{1} << 20) - 1;
+constexpr uint64_t fnv_offset_basis = 0xcbf29ce484222325ULL;
+constexpr uint64_t fnv_prime = 0x100000001b3ULL;
+constexpr size_t io_buffer_size = 1024 * 1024;
+
+const std::array<uint64_t, 256>& gear_table() {
+    // Fixed pseudo-random table (splitmix64), the chunk boundaries must be stable across the runs.
+    static const auto table = [] {
+        std::array<uint64_t, 256> values{};
+        uint64_t state = 0;
+        for (auto& value : values) {
+            state += 0x9e3779b97f4a7c15ULL;
+            uint64_t z = state;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            value = z ^ (z >> 31);
+        }
+        return values;
+    }();
+    return table;
+}
+
+std::vector<ChunkInfo> split_into_chunks(std::istream& stream, uint64_t pos, uint64_t size) {
+    const auto& gear = gear_table();
+    std::vector<ChunkInfo> chunks;
+    std::vector<char> buffer(io_buffer_size);
+    uint64_t chunk_pos = pos, chunk_size = 0, rolling_hash = 0, content_hash = fnv_offset_basis;
+
+    stream.seekg(pos);
+    for (uint64_t done = 0; done < size;) {
+        const auto n = std::min<uint64_t>(buffer.size(), size - done);
+        stream.read(buffer.data(), static_cast<std::streamsize>(n));
+        OPENVINO_ASSERT(stream.good(), "Failed to read back the blob data at ", pos + done);
+        for (uint64_t i = 0; i < n; ++i) {
+            const auto byte = static_cast<uint8_t>(buffer[i]);
+            rolling_hash = (rolling_hash << 1) + gear[byte];
+            content_hash = (content_hash ^ byte) * fnv_prime;
+            ++chunk_size;
+            if ((chunk_size >= min_chunk_size && (rolling_hash & chunk_boundary_mask) == 0) ||
+                chunk_size == max_chunk_size) {
+                chunks.push_back({chunk_pos, chunk_size, content_hash});
+                chunk_pos += chunk_size;
+                chunk_size = 0;
+                rolling_hash = 0;
+                content_hash = fnv_offset_basis;
+            }
+        }
+        done += n;
+    }
+    if (chunk_size > 0) {
+        chunks.push_back({chunk_pos, chunk_size, content_hash});
+    }
+    return chunks;
+}
+
+bool equal_file_ranges(std::istream& stream, uint64_t lhs_pos, uint64_t rhs_pos, uint64_t size) {
+    std::vector<char> lhs(std::min<uint64_t>(io_buffer_size, size));
+    std::vector<char> rhs(lhs.size());
+    for (uint64_t done = 0; done < size;) {
+        const auto n = static_cast<std::streamsize>(std::min<uint64_t>(lhs.size(), size - done));
+        stream.seekg(lhs_pos + done);
+        stream.read(lhs.data(), n);
+        stream.seekg(rhs_pos + done);
+        stream.read(rhs.data(), n);
+        if (!stream.good() || std::memcmp(lhs.data(), rhs.data(), static_cast<size_t>(n)) != 0) {
+            stream.clear();
+            return false;
+        }
+        done += n;
+    }
+    return true;
+}
+
+// Moves the data towards the beginning of the file (dst_pos <= src_pos), the ranges may overlap.
+void move_file_range(std::fstream& stream, uint64_t src_pos, uint64_t dst_pos, uint64_t size) {
+    std::vector<char> buffer(std::min<uint64_t>(io_buffer_size, size));
+    for (uint64_t done = 0; done < size;) {
+        const auto n = static_cast<std::streamsize>(std::min<uint64_t>(buffer.size(), size - done));
+        stream.seekg(src_pos + done);
+        stream.read(buffer.data(), n);
+        stream.seekp(dst_pos + done);
+        stream.write(buffer.data(), n);
+        OPENVINO_ASSERT(stream.good(), "Failed to move the chunk data from ", src_pos, " to ", dst_pos);
+        done += n;
+    }
+}
+
+bool is_contiguous(const std::vector<ChunkInfo>& chunks) {
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        if (chunks[i].offset != chunks[i - 1].offset + chunks[i - 1].size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** @brief Read-only stream buffer presenting the chunks scattered over the file as a single sequence. */
+class ChunkedReadStreamBuf : public std::streambuf {
+public:
+    ChunkedReadStreamBuf(const std::filesystem::path& path, const std::vector<ChunkInfo>& chunks)
+        : m_file(path, std::ios::binary),
+          m_chunks(chunks),
+          m_buffer(io_buffer_size) {
+        m_chunk_begins.reserve(m_chunks.size() + 1);
+        uint64_t total = 0;
+        for (const auto& chunk : m_chunks) {
+            m_chunk_begins.push_back(total);
+            total += chunk.size;
+        }
+        m_chunk_begins.push_back(total);
+        setg(m_buffer.data(), m_buffer.data(), m_buffer.data());
+    }
+
+protected:
+    int_type underflow() override {
+        if (gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());
+        }
+        const auto total = m_chunk_begins.back();
+        if (m_pos >= total) {
+            return traits_type::eof();
+        }
+        const auto idx = static_cast<size_t>(
+            std::upper_bound(m_chunk_begins.begin(), m_chunk_begins.end(), m_pos) - m_chunk_begins.begin() - 1);
+        const auto in_chunk = m_pos - m_chunk_begins[idx];
+        const auto n = std::min<uint64_t>(m_buffer.size(), m_chunks[idx].size - in_chunk);
+        m_file.seekg(m_chunks[idx].offset + in_chunk);
+        m_file.read(m_buffer.data(), static_cast<std::streamsize>(n));
+        if (static_cast<uint64_t>(m_file.gcount()) != n) {
+            return traits_type::eof();
+        }
+        m_pos += n;
+        setg(m_buffer.data(), m_buffer.data(), m_buffer.data() + n);
+        return traits_type::to_int_type(*gptr());
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir way, std::ios_base::openmode which) override {
+        const auto current = static_cast<off_type>(m_pos) - static_cast<off_type>(egptr() - gptr());
+        off_type target = off;
+        if (way == std::ios_base::cur) {
+            target += current;
+        } else if (way == std::ios_base::end) {
+            target += static_cast<off_type>(m_chunk_begins.back());
+        }
+        return seekpos(pos_type(target), which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        const auto target = static_cast<off_type>(pos);
+        if (!(which & std::ios_base::in) || target < 0 || static_cast<uint64_t>(target) > m_chunk_begins.back()) {
+            return pos_type(off_type(-1));
+        }
+        m_pos = static_cast<uint64_t>(target);
+        setg(m_buffer.data(), m_buffer.data(), m_buffer.data());
+        return pos;
+    }
+
+private:
+    std::ifstream m_file;
+    std::vector<ChunkInfo> m_chunks;
+    std::vector<uint64_t> m_chunk_begins;
+    std::vector<char> m_buffer;
+    uint64_t m_pos = 0;  // logical position of the buffer end
+};
 }  // namespace
 
 const size_t SingleFileStorage::blob_alignment = []() {
@@ -193,8 +367,57 @@ bool SingleFileStorage::build_content_index(std::ifstream& stream) {
         s.seekg(weight_size, std::ios::cur);
         return s.good();
     };
+    const auto chunk_data_reader = [](std::istream& s, TLVTraits::LengthType size) {
+        // the chunks are referenced by the BlobChunks records, so the data is just validated and skipped
+        constexpr auto header_size = sizeof(BlobIdType) + sizeof(PadSizeType);
+        if (size < header_size) {
+            return false;
+        }
+        BlobIdType id;
+        PadSizeType padding_size;
+        s.read(reinterpret_cast<char*>(&id), sizeof(id));
+        s.read(reinterpret_cast<char*>(&padding_size), sizeof(padding_size));
+        if (!s.good() || padding_size > size - header_size) {
+            return false;
+        }
+        s.seekg(static_cast<std::streamoff>(size - header_size), std::ios::cur);
+        return s.good();
+    };
+    const auto blob_chunks_reader = [this](std::istream& s, TLVTraits::LengthType size) {
+        constexpr auto header_size = sizeof(BlobIdType) + sizeof(uint64_t);
+        constexpr auto chunk_meta_size = 3 * sizeof(uint64_t);
+        if (size < header_size) {
+            return false;
+        }
+        BlobIdType id;
+        uint64_t count;
+        s.read(reinterpret_cast<char*>(&id), sizeof(id));
+        s.read(reinterpret_cast<char*>(&count), sizeof(count));
+        if (!s.good() || (size - header_size) / chunk_meta_size != count || (size - header_size) % chunk_meta_size) {
+            return false;
+        }
+        std::vector<ChunkInfo> chunks(count);
+        uint64_t blob_size = 0;
+        for (auto& chunk : chunks) {
+            s.read(reinterpret_cast<char*>(&chunk.offset), sizeof(chunk.offset));
+            s.read(reinterpret_cast<char*>(&chunk.size), sizeof(chunk.size));
+            s.read(reinterpret_cast<char*>(&chunk.hash), sizeof(chunk.hash));
+            blob_size += chunk.size;
+        }
+        if (!s.good()) {
+            return false;
+        }
+        if (!chunks.empty()) {
+            m_blob_index[id].offset = chunks.front().offset;
+            m_blob_index[id].size = blob_size;
+        }
+        register_chunks(id, std::move(chunks));
+        return true;
+    };
     const TLVValueScanner scanners = {
         {static_cast<TLVTraits::TagType>(Tag::Blob), blob_reader},
+        {static_cast<TLVTraits::TagType>(Tag::BlobChunks), blob_chunks_reader},
+        {static_cast<TLVTraits::TagType>(Tag::ChunkData), chunk_data_reader},
         {static_cast<TLVTraits::TagType>(Tag::BlobMap), blob_map_reader},
         {static_cast<TLVTraits::TagType>(Tag::ConstantMeta), constant_meta_reader},
         {static_cast<TLVTraits::TagType>(Tag::WeightSource), weight_source_reader},
@@ -210,9 +433,59 @@ bool SingleFileStorage::has_blob_id(BlobIdType blob_id) const {
     return m_blob_index.find(blob_id) != m_blob_index.end();
 }
 
-void SingleFileStorage::write_blob_entry(std::fstream& stream, BlobIdType blob_id, StreamWriter& writer) {
+void SingleFileStorage::register_chunks(BlobIdType blob_id, std::vector<ChunkInfo> chunks) {
+    for (const auto& chunk : chunks) {
+        auto& locations = m_chunk_index[chunk.hash];
+        const auto same_location = [&](const ChunkInfo& c) {
+            return c.offset == chunk.offset && c.size == chunk.size;
+        };
+        if (std::none_of(locations.begin(), locations.end(), same_location)) {
+            locations.push_back(chunk);
+        }
+    }
+    m_blob_index[blob_id].chunks = std::move(chunks);
+}
+
+std::vector<SingleFileStorage::ChunkInfo> SingleFileStorage::deduplicate_chunks(std::fstream& stream,
+                                                                                const std::vector<ChunkInfo>& chunks,
+                                                                                uint64_t data_pos) const {
+    // The unique chunks are compacted to the beginning of the blob data, the repeated ones refer to the stored copy.
+    // The hash only preselects the candidates, a chunk is a copy only if its bytes match the stored ones, since the
+    // 64-bit FNV-1a hash may collide and a false match would silently corrupt the cached blob.
+    std::vector<ChunkInfo> stored;
+    stored.reserve(chunks.size());
+    auto dst_pos = data_pos;
+    for (const auto& chunk : chunks) {
+        const auto is_copy = [&](const ChunkInfo& c) {
+            return c.hash == chunk.hash && c.size == chunk.size &&
+                   equal_file_ranges(stream, c.offset, chunk.offset, chunk.size);
+        };
+        const ChunkInfo* copy = nullptr;
+        if (auto it = m_chunk_index.find(chunk.hash); it != m_chunk_index.end()) {
+            auto found = std::find_if(it->second.begin(), it->second.end(), is_copy);
+            copy = found != it->second.end() ? &*found : nullptr;
+        }
+        if (!copy) {
+            auto found = std::find_if(stored.begin(), stored.end(), is_copy);
+            copy = found != stored.end() ? &*found : nullptr;
+        }
+        if (copy) {
+            stored.push_back(*copy);
+        } else {
+            if (chunk.offset != dst_pos) {
+                move_file_range(stream, chunk.offset, dst_pos, chunk.size);
+            }
+            stored.push_back({dst_pos, chunk.size, chunk.hash});
+            dst_pos += chunk.size;
+        }
+    }
+    return stored;
+}
+
+std::streampos SingleFileStorage::write_blob_entry(std::fstream& stream, BlobIdType blob_id, StreamWriter& writer) {
     OPENVINO_ASSERT(!has_blob_id(blob_id), "Blob with id ", blob_id, " already exists in cache.");
 
+    const auto record_pos = stream.tellp();
     std::streampos blob_pos;
     std::streamoff blob_size;
 
@@ -226,6 +499,40 @@ void SingleFileStorage::write_blob_entry(std::fstream& stream, BlobIdType blob_i
         OPENVINO_ASSERT(blob_size >= 0, "Invalid blob size ", blob_size, " for blob id ", blob_id);
     };
     write_tlv_record(stream, static_cast<TLVTraits::TagType>(Tag::Blob), blob_writer);
+    const auto blob_end = static_cast<uint64_t>(stream.tellp());
+    stream.flush();
+
+    // The content already stored for other entries (e.g. the weights shared by several device or config variants of
+    // a model) is not stored again: the blob is rewritten in place as its unique chunks followed by the chunks map.
+    const auto data_pos = static_cast<uint64_t>(blob_pos);
+    auto chunks = deduplicate_chunks(stream, split_into_chunks(stream, data_pos, blob_size), data_pos);
+    uint64_t data_end = data_pos;
+    for (const auto& chunk : chunks) {
+        if (chunk.offset >= data_pos) {
+            data_end = std::max(data_end, chunk.offset + chunk.size);
+        }
+    }
+    if (data_end < blob_end) {
+        const auto tag = static_cast<TLVTraits::TagType>(Tag::ChunkData);
+        const TLVTraits::LengthType length =
+            data_end - (static_cast<uint64_t>(record_pos) + sizeof(tag) + sizeof(TLVTraits::LengthType));
+        stream.seekp(record_pos);
+        stream.write(reinterpret_cast<const char*>(&tag), sizeof(tag));
+        stream.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    }
+    stream.seekp(static_cast<std::streamoff>(data_end < blob_end ? data_end : blob_end));
+    if (!chunks.empty()) {
+        write_tlv_record(stream, static_cast<TLVTraits::TagType>(Tag::BlobChunks), [&](std::ostream& s) {
+            const uint64_t count = chunks.size();
+            s.write(reinterpret_cast<const char*>(&blob_id), sizeof(blob_id));
+            s.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            for (const auto& chunk : chunks) {
+                s.write(reinterpret_cast<const char*>(&chunk.offset), sizeof(chunk.offset));
+                s.write(reinterpret_cast<const char*>(&chunk.size), sizeof(chunk.size));
+                s.write(reinterpret_cast<const char*>(&chunk.hash), sizeof(chunk.hash));
+            }
+        });
+    }
 
     std::string model_name;  // Intentionally empty
 
@@ -235,14 +542,24 @@ void SingleFileStorage::write_blob_entry(std::fstream& stream, BlobIdType blob_i
     };
     write_tlv_record(stream, static_cast<TLVTraits::TagType>(Tag::BlobMap), blob_map_writer);
 
-    m_blob_index[blob_id] = {static_cast<uint64_t>(blob_pos), static_cast<uint64_t>(blob_size), std::move(model_name)};
+    const auto stored_pos = chunks.empty() ? static_cast<uint64_t>(blob_pos) : chunks.front().offset;
+    m_blob_index[blob_id] = {stored_pos, static_cast<uint64_t>(blob_size), std::move(model_name)};
+    register_chunks(blob_id, std::move(chunks));
+    return stream.tellp();
 }
 
 void SingleFileStorage::write_cache_entry(const std::string& blob_id, StreamWriter writer) {
     ScopedLocale plocal_C(LC_ALL, "C");
-    std::fstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
-    OPENVINO_ASSERT(stream.good(), "Failed to open cache file ", m_file_path, " for writing blob id ", blob_id);
-    write_blob_entry(stream, convert_blob_id(blob_id), writer);
+    std::streampos entry_end;
+    {
+        std::fstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
+        OPENVINO_ASSERT(stream.good(), "Failed to open cache file ", m_file_path, " for writing blob id ", blob_id);
+        entry_end = write_blob_entry(stream, convert_blob_id(blob_id), writer);
+    }
+    // drop the tail left after the deduplicated blob data was compacted
+    if (entry_end > 0 && std::filesystem::file_size(m_file_path) > static_cast<uintmax_t>(entry_end)) {
+        std::filesystem::resize_file(m_file_path, static_cast<uintmax_t>(entry_end));
+    }
 }
 
 void SingleFileStorage::read_cache_entry(const std::string& blob_id, bool enable_mmap, StreamReader reader) {
@@ -251,8 +568,35 @@ void SingleFileStorage::read_cache_entry(const std::string& blob_id, bool enable
     const auto cid = convert_blob_id(blob_id);
 
     if (std::filesystem::exists(m_file_path) && has_blob_id(cid)) {
-        const auto& [blob_pos, blob_size, model_name] = m_blob_index[cid];
-        if (enable_mmap) {
+        const auto& [blob_pos, blob_size, model_name, chunks] = m_blob_index[cid];
+        if (!is_contiguous(chunks)) {
+            // The deduplicated blob is scattered over the file, while the reader expects a single contiguous tensor.
+            // The chunks can't be mapped side by side: their boundaries are content defined, so they start and end
+            // at any byte (that's what makes the shifted content deduplicate), and the file mappings are page
+            // granular. So the chunks are read into one allocation, which costs the same memory as a mapped blob
+            // once it's touched, with the parallel reads directly into the destination.
+            if (enable_mmap) {
+                ov::Tensor tensor(element::u8, Shape{static_cast<size_t>(blob_size)});
+                ov::util::ParallelReadStreamBuf par_buf(m_file_path);
+                auto dst = static_cast<char*>(tensor.data());
+                for (const auto& chunk : chunks) {
+                    const auto size = static_cast<std::streamsize>(chunk.size);
+                    OPENVINO_ASSERT(par_buf.pubseekpos(static_cast<std::streamoff>(chunk.offset), std::ios::in) ==
+                                            static_cast<std::streamoff>(chunk.offset) &&
+                                        par_buf.sgetn(dst, size) == size,
+                                    "Failed to read chunk of blob id ",
+                                    blob_id);
+                    dst += chunk.size;
+                }
+                CompiledBlobVariant compiled_blob{std::in_place_index<0>, std::move(tensor)};
+                reader(compiled_blob);
+            } else {
+                ChunkedReadStreamBuf chunked_buf(m_file_path, chunks);
+                std::istream stream(&chunked_buf);
+                CompiledBlobVariant compiled_blob{std::in_place_index<1>, std::ref(stream)};
+                reader(compiled_blob);
+            }
+        } else if (enable_mmap) {
             CompiledBlobVariant compiled_blob{std::in_place_index<0>,
                                               read_tensor_data(m_file_path,
                                                                element::u8,
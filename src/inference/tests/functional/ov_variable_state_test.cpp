@@ -32,3 +32,9 @@ TEST_F(VariableStateOVTests, throwsOnUninitializedSetState) {
     ov::Tensor tensor;
     ASSERT_THROW(state.set_state(tensor), ov::Exception);
 }
+
+TEST_F(VariableStateOVTests, throwsOnUninitializedSetStateFromState) {
+    ov::VariableState state;
+    ov::VariableState source;
+    ASSERT_THROW(state.set_state(source), ov::Exception);
+}
@@ -9,6 +9,7 @@
 
 #include "common_test_utils/test_assertions.hpp"
 #include "openvino/core/parallel.hpp"
+#include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
 
@@ -215,6 +216,33 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+// The tasks submitted from a stream thread are queued to the stream itself, so they can only run
+// if another stream of the same NUMA node steals them while the submitting task waits. Each node
+// gets two streams, as the streams never take the tasks of another node.
+TEST(CPUStreamsExecutorTests, idleStreamStealsTasksOfBusyStream) {
+    const auto streams = static_cast<int>(2 * get_available_numa_nodes().size());
+    auto taskExecutor =
+        std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, 1});
+    std::atomic_int executed = {0};
+    auto f = async(taskExecutor, [&] {
+        std::vector<Future> nested;
+        for (int i = 0; i < 2; i++) {
+            nested.push_back(async(taskExecutor, [&] {
+                executed++;
+            }));
+        }
+        for (auto& n : nested) {
+            n.wait();
+        }
+    });
+    f.wait();
+    OV_ASSERT_NO_THROW(f.get());
+    ASSERT_EQ(2, executed);
+    // the outer task itself may be stolen as well
+    ASSERT_GE(taskExecutor->get_steals_num(), 2u);
+    ASSERT_EQ(0u, taskExecutor->get_queue_depth());
+}
+
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 static auto Executors = ::testing::Values(
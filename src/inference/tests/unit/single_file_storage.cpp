@@ -236,6 +236,70 @@ TEST_F(SingleFileStorageTest, WriteReadLargeBlob_ParallelPath) {
     });
 }
 
+TEST_F(SingleFileStorageTest, DeduplicateCommonContent) {
+    // Three variants of a blob sharing the same large "weights" part surrounded by the variant specific data.
+    std::vector<uint8_t> weights(9UL * 1024 * 1024);
+    uint64_t state = 1;
+    for (auto& byte : weights) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        byte = static_cast<uint8_t>(state >> 56);
+    }
+    const auto make_variant = [&](uint8_t variant) {
+        std::vector<uint8_t> blob(1000 + variant * 37, variant);
+        blob.insert(blob.end(), weights.begin(), weights.end());
+        blob.resize(blob.size() + 500, static_cast<uint8_t>(variant + 7));
+        return blob;
+    };
+    const std::map<std::string, std::vector<uint8_t>> test_blobs{{"1", make_variant(1)},
+                                                                 {"2", make_variant(2)},
+                                                                 {"3", make_variant(3)}};
+
+    m_storage->write_cache_entry("1", [&](std::ostream& s) {
+        s.write(reinterpret_cast<const char*>(test_blobs.at("1").data()), test_blobs.at("1").size());
+    });
+    const auto size_after_first = test::utils::fileSize(m_file_path.string());
+    m_storage->write_cache_entry("2", [&](std::ostream& s) {
+        s.write(reinterpret_cast<const char*>(test_blobs.at("2").data()), test_blobs.at("2").size());
+    });
+    const auto size_after_second = test::utils::fileSize(m_file_path.string());
+    EXPECT_LT(size_after_second - size_after_first, weights.size() / 2) << "Common content is stored again";
+
+    // the chunk index survives the reopening
+    m_storage.reset();
+    SingleFileStorage reopened_storage(m_file_path);
+    reopened_storage.initialize();
+    reopened_storage.write_cache_entry("3", [&](std::ostream& s) {
+        s.write(reinterpret_cast<const char*>(test_blobs.at("3").data()), test_blobs.at("3").size());
+    });
+    EXPECT_LT(test::utils::fileSize(m_file_path.string()) - size_after_second, weights.size() / 2)
+        << "Common content is stored again after reopening";
+
+    for (const auto& [blob_id, blob_data] : test_blobs) {
+        size_t read_count = 0;
+        reopened_storage.read_cache_entry(blob_id, false, [&](const ICacheManager::CompiledBlobVariant& compiled_blob) {
+            ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<std::istream>>(compiled_blob));
+            ++read_count;
+            auto& stream = std::get<std::reference_wrapper<std::istream>>(compiled_blob).get();
+            std::vector<uint8_t> read_data(blob_data.size());
+            ASSERT_TRUE(stream.read(reinterpret_cast<char*>(read_data.data()), read_data.size()));
+            EXPECT_EQ(blob_data, read_data);
+            // seeking works across the chunks
+            stream.seekg(-1, std::ios::end);
+            EXPECT_EQ(static_cast<uint8_t>(stream.get()), blob_data.back());
+            stream.seekg(blob_data.size() / 2);
+            EXPECT_EQ(static_cast<uint8_t>(stream.get()), blob_data[blob_data.size() / 2]);
+        });
+        reopened_storage.read_cache_entry(blob_id, true, [&](const ICacheManager::CompiledBlobVariant& compiled_blob) {
+            ASSERT_TRUE(std::holds_alternative<const ov::Tensor>(compiled_blob));
+            ++read_count;
+            auto& tensor = std::get<const ov::Tensor>(compiled_blob);
+            ASSERT_EQ(tensor.get_byte_size(), blob_data.size());
+            EXPECT_EQ(std::memcmp(tensor.data(), blob_data.data(), blob_data.size()), 0);
+        });
+        EXPECT_EQ(read_count, 2);
+    }
+}
+
 TEST_F(SingleFileStorageTest, ContextMetaWriteRead) {
     weight_sharing::Context test_context;
     test_context.m_weight_registry[1][11] = {100, 200, element::Type_t::f32};
@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/threading/thread_safe_containers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace ov::threading;
+
+TEST(MPMCBoundedQueueTest, KeepsFifoOrderUpToCapacity) {
+    MPMCBoundedQueue<int> queue(3);
+    ASSERT_EQ(queue.capacity(), 4u);
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+    int value = 42;
+    ASSERT_FALSE(queue.try_push(value));
+    ASSERT_EQ(value, 42);
+    ASSERT_EQ(queue.size(), 4u);
+
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_EQ(queue.size(), 0u);
+}
+
+TEST(MPMCBoundedQueueTest, ReleasesPoppedElements) {
+    MPMCBoundedQueue<std::shared_ptr<int>> queue(2);
+    auto element = std::make_shared<int>(1);
+    auto copy = element;
+    ASSERT_TRUE(queue.try_push(copy));
+    std::shared_ptr<int> popped;
+    ASSERT_TRUE(queue.try_pop(popped));
+    popped.reset();
+    ASSERT_EQ(element.use_count(), 1);
+}
+
+TEST(MPMCBoundedQueueTest, DeliversEveryElementOnceUnderContention) {
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int per_producer = 20000;
+    MPMCBoundedQueue<int> queue(64);
+    std::vector<std::atomic<int>> seen(producers * per_producer);
+    std::atomic<int> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < per_producer; i++) {
+                int value = p * per_producer + i;
+                while (!queue.try_push(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&] {
+            int value = 0;
+            while (consumed.load() < producers * per_producer) {
+                if (queue.try_pop(value)) {
+                    seen[value]++;
+                    consumed++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& count : seen) {
+        ASSERT_EQ(count.load(), 1);
+    }
+}
+
+TEST(ThreadSafeQueueWithSizeTest, KeepsOrderWhenRingOverflows) {
+    ThreadSafeQueueWithSize<int> queue(4);
+    for (int i = 0; i < 10; i++) {
+        queue.push(i);
+    }
+    ASSERT_EQ(queue.size(), 10u);
+
+    int value = 0;
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(value, 0);
+    // the overflow is not drained yet, so the new element must not overtake it through the ring
+    queue.push(10);
+    for (int i = 1; i <= 10; i++) {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_EQ(queue.size(), 0u);
+}
@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Measures the throughput of the thread-safe task queues under the producers/consumers contention, e.g.:
+//   ov_thread_safe_queue_benchmark --gtest_filter=*Throughput*
+// The target is not built by default, the numbers are meaningful for the Release builds only.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "openvino/runtime/threading/thread_safe_containers.hpp"
+
+namespace ov::test {
+
+namespace {
+
+constexpr size_t operations_per_producer = 1000000;
+
+// The queue the ThreadSafeQueueWithSize used to be, kept as the baseline
+template <typename T>
+class MutexQueue {
+public:
+    void push(T value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push(std::move(value));
+    }
+    bool try_pop(T& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_queue.empty()) {
+            return false;
+        }
+        value = std::move(_queue.front());
+        _queue.pop();
+        return true;
+    }
+
+private:
+    std::queue<T> _queue;
+    std::mutex _mutex;
+};
+
+template <typename Queue>
+double measure_mops(size_t producers, size_t consumers) {
+    Queue queue;
+    std::atomic<size_t> consumed{0};
+    const size_t total = producers * operations_per_producer;
+    std::vector<std::thread> threads;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t p = 0; p < producers; p++) {
+        threads.emplace_back([&] {
+            for (size_t i = 0; i < operations_per_producer; i++) {
+                queue.push(i);
+            }
+        });
+    }
+    for (size_t c = 0; c < consumers; c++) {
+        threads.emplace_back([&] {
+            size_t value = 0;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (queue.try_pop(value)) {
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(total) / elapsed.count() / 1e6;
+}
+
+}  // namespace
+
+class ThreadSafeQueueBenchmark : public ::testing::TestWithParam<std::tuple<size_t, size_t>> {};
+
+TEST_P(ThreadSafeQueueBenchmark, Throughput) {
+    const auto [producers, consumers] = GetParam();
+    const auto mutex_mops = measure_mops<MutexQueue<size_t>>(producers, consumers);
+    const auto lock_free_mops = measure_mops<threading::ThreadSafeQueueWithSize<size_t>>(producers, consumers);
+    std::cout << producers << " producers, " << consumers << " consumers: std::mutex queue " << mutex_mops
+              << " Mops/s, ThreadSafeQueueWithSize " << lock_free_mops << " Mops/s" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(Contention,
+                         ThreadSafeQueueBenchmark,
+                         ::testing::Combine(::testing::Values(1, 2, 4, 8), ::testing::Values(1, 2, 4, 8)),
+                         [](const ::testing::TestParamInfo<std::tuple<size_t, size_t>>& info) {
+                             return "P" + std::to_string(std::get<0>(info.param)) + "_C" +
+                                    std::to_string(std::get<1>(info.param));
+                         });
+
+}  // namespace ov::test
@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+#ifdef AUTOBATCH_UNITTEST
+#    define autobatch_plugin mock_autobatch_plugin
+#endif
+
+namespace ov {
+namespace autobatch_plugin {
+
+/**
+ * @brief Decides how long the worker of a batched request may keep collecting the requests.
+ * The policy tracks the moving averages of the requests inter-arrival time and of the batched execution latency.
+ * A collected (partial) batch is flushed as soon as either the oldest request would miss its latency budget when
+ * waiting any longer, or the batch is not expected to be filled up within the remaining budget anyway,
+ * so the requests do not wait for the timeout in vain under the sparse traffic.
+ */
+class AdaptiveBatchingPolicy {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit AdaptiveBatchingPolicy(std::chrono::milliseconds latency_budget) : m_budget(latency_budget) {}
+
+    void set_latency_budget(std::chrono::milliseconds latency_budget) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_budget = latency_budget;
+    }
+
+    /**
+     * @brief The policy is enabled by a non-zero latency budget, otherwise the batch is collected for the fixed timeout
+     */
+    bool is_enabled() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_budget.count() > 0;
+    }
+
+    /**
+     * @brief Registers a new request in the queue
+     * @param queued the number of requests in the queue including the new one
+     */
+    void on_arrival(size_t queued, Clock::time_point now = Clock::now()) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_has_arrivals) {
+            update_average(m_inter_arrival, now - m_last_arrival);
+        }
+        m_has_arrivals = true;
+        m_last_arrival = now;
+        if (queued == 1 || !m_has_pending) {
+            m_oldest_pending = now;
+            m_has_pending = true;
+        }
+    }
+
+    /**
+     * @brief Marks the queue as drained (the collected requests are submitted for execution)
+     */
+    void on_flush() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_has_pending = false;
+    }
+
+    /**
+     * @brief Accounts the measured latency of the batched execution
+     */
+    void on_batch_completed(Clock::duration latency) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        update_average(m_batch_latency, latency);
+    }
+
+    /**
+     * @brief Computes how long the worker may wait for the rest of the batch
+     * @param queued the number of the collected requests
+     * @param batch_size the batch size of the compiled batched model
+     * @param max_wait the upper bound of the waiting time (the collection timeout)
+     * @return zero duration if the collected requests should be flushed right away
+     */
+    Clock::duration wait_time(size_t queued,
+                              size_t batch_size,
+                              Clock::duration max_wait,
+                              Clock::time_point now = Clock::now()) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!queued || !m_has_pending || queued >= batch_size) {
+            return queued >= batch_size ? Clock::duration::zero() : max_wait;
+        }
+        const auto deadline = m_oldest_pending + std::chrono::duration_cast<Clock::duration>(m_budget);
+        const auto remaining = deadline - now - m_batch_latency;
+        if (remaining <= Clock::duration::zero()) {
+            return Clock::duration::zero();
+        }
+        // the batch cannot be filled up in time, so waiting would only add the latency
+        const auto expected_fill = m_inter_arrival * static_cast<Clock::rep>(batch_size - queued);
+        if (m_inter_arrival > Clock::duration::zero() && expected_fill > remaining) {
+            return Clock::duration::zero();
+        }
+        return std::min(remaining, max_wait);
+    }
+
+private:
+    // exponential moving average with 1/8 weight of the new sample
+    static void update_average(Clock::duration& average, Clock::duration sample) {
+        average = average == Clock::duration::zero() ? sample : average + (sample - average) / 8;
+    }
+
+    mutable std::mutex m_mutex;
+    std::chrono::milliseconds m_budget;
+    Clock::duration m_inter_arrival = Clock::duration::zero();
+    Clock::duration m_batch_latency = Clock::duration::zero();
+    Clock::time_point m_last_arrival;
+    Clock::time_point m_oldest_pending;
+    bool m_has_arrivals = false;
+    bool m_has_pending = false;
+};
+
+}  // namespace autobatch_plugin
+}  // namespace ov
@@ -68,7 +68,9 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
-                if (sz == workerInferRequest->_batch_size) {
+                workerInferRequest->_policy.on_arrival(sz);
+                // with the latency budget the worker re-evaluates the deadline of the partial batch on every arrival
+                if (sz == workerInferRequest->_batch_size || workerInferRequest->_policy.is_enabled()) {
                     workerInferRequest->_is_wakeup = true;
                     workerInferRequest->_cond.notify_one();
                 }
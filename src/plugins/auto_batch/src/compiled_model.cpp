@@ -5,10 +5,23 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "compiled_model.hpp"
 
+#include <thread>
+
 #include "async_infer_request.hpp"
 
 namespace ov {
 namespace autobatch_plugin {
+namespace {
+// size() counts the published tasks only, yet such a task may still wait in the queue behind a task which push is in
+// progress, so the pop is retried until that push completes
+template <typename Queue, typename T>
+void pop_published(Queue& queue, T& value) {
+    while (!queue.try_pop(value)) {
+        std::this_thread::yield();
+    }
+}
+}  // namespace
+
 CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              const ov::AnyMap& config,
@@ -17,18 +30,24 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::size_t>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const std::map<std::size_t, ov::SoPtr<ov::ICompiledModel>>&
+                                 compiled_models_with_smaller_batch)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
       m_compiled_model_with_batch(compiled_model_with_batch),
-      m_compiled_model_without_batch(compiled_model_without_batch) {
+      m_compiled_model_without_batch(compiled_model_without_batch),
+      m_compiled_models_with_smaller_batch(compiled_models_with_smaller_batch) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     m_device_info = device_info;
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto latency_budget = config.find(ov::auto_batch::latency_budget.name());
+    if (latency_budget != config.end())
+        m_latency_budget = latency_budget->second.as<std::uint32_t>();
 }
 
 CompiledModel::~CompiledModel() {
@@ -63,12 +82,21 @@ CompiledModel::GetWorkerInferRequest() const {
         if (workerRequestPtr->_infer_request_batched._so == nullptr)
             workerRequestPtr->_infer_request_batched._so = m_compiled_model_with_batch._so;
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
+        for (const auto& compiled_model : m_compiled_models_with_smaller_batch) {
+            const auto batch_size = static_cast<int>(compiled_model.first);
+            workerRequestPtr->_infer_requests_with_smaller_batch[batch_size] = {
+                compiled_model.second->create_infer_request(),
+                compiled_model.second._so};
+        }
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_is_wakeup = false;
+        workerRequestPtr->_policy.set_latency_budget(std::chrono::milliseconds(m_latency_budget));
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                workerRequestPtr->_policy.on_batch_completed(AdaptiveBatchingPolicy::Clock::now() -
+                                                             workerRequestPtr->_batch_start);
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
@@ -84,7 +112,16 @@ CompiledModel::GetWorkerInferRequest() const {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    AdaptiveBatchingPolicy::Clock::duration wait_time = std::chrono::milliseconds(m_time_out);
+                    if (workerRequestPtr->_policy.is_enabled()) {
+                        // flush the partial batch right away if it would miss the latency budget otherwise
+                        wait_time = workerRequestPtr->_policy.wait_time(workerRequestPtr->_tasks.size(),
+                                                                        workerRequestPtr->_batch_size,
+                                                                        wait_time);
+                    }
+                    status = wait_time == AdaptiveBatchingPolicy::Clock::duration::zero()
+                                 ? std::cv_status::timeout
+                                 : workerRequestPtr->_cond.wait_for(lock, wait_time);
                     if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
                         continue;
                     workerRequestPtr->_is_wakeup = false;
@@ -93,36 +130,81 @@ CompiledModel::GetWorkerInferRequest() const {
                     break;
                 } else {
                     // as we pop the tasks from the queue only here
-                    // it is ok to call size() (as the _tasks can only grow in parallel)
+                    // it is ok to call size() (as the published _tasks can only grow in parallel)
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
                     if (sz == workerRequestPtr->_batch_size) {
+                        workerRequestPtr->_policy.on_flush();
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
                         for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                            pop_published(workerRequestPtr->_tasks, t);
                             workerRequestPtr->_completion_tasks[n] = std::move(t.second);
                             t.first->m_sync_request->copy_inputs_if_needed();
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_batch_start = AdaptiveBatchingPolicy::Clock::now();
                         workerRequestPtr->_infer_request_batched->start_async();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
+                        // timeout to collect the batch is over (or the latency budget does not allow waiting
+                        // any longer), have to execute the collected requests in the largest compiled batches that
+                        // fit (if any besides the batchN one), and the rest of the requests in the batch1 mode
+                        workerRequestPtr->_policy.on_flush();
+                        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks(sz);
+                        // popping all tasks collected by the moment of the time-out
+                        for (int n = 0; n < sz; n++) {
+                            pop_published(workerRequestPtr->_tasks, tasks[n]);
+                        }
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->m_request_without_batch->set_callback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
-                                    if (p)
-                                        t.first->m_sync_request->m_exception_ptr = p;
-                                    t.second();
-                                    if (sz == ++arrived) {
-                                        all_completed.set_value();
+                        auto on_completed = [sz, &arrived, &all_completed] {
+                            if (sz == ++arrived) {
+                                all_completed.set_value();
+                            }
+                        };
+                        int n = 0;
+                        // as the smaller batches are powers of two below the batchN, each of them is used once at most
+                        for (auto it = workerRequestPtr->_infer_requests_with_smaller_batch.rbegin();
+                             it != workerRequestPtr->_infer_requests_with_smaller_batch.rend();
+                             ++it) {
+                            const int batch_size = it->first;
+                            if (sz - n < batch_size)
+                                continue;
+                            auto& request = it->second;
+                            std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
+                                batch_tasks(tasks.begin() + n, tasks.begin() + n + batch_size);
+                            n += batch_size;
+                            for (int b = 0; b < batch_size; b++) {
+                                auto& sync_request = batch_tasks[b].first->m_sync_request;
+                                sync_request->copy_inputs_to_another_batch(request, b, batch_size);
+                                sync_request->m_batched_request_status =
+                                    ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                            }
+                            request->set_callback(
+                                [batch_tasks, &request, &on_completed](std::exception_ptr p) {
+                                    const auto size = batch_tasks.size();
+                                    for (size_t b = 0; b < size; b++) {
+                                        auto& sync_request = batch_tasks[b].first->m_sync_request;
+                                        if (p)
+                                            sync_request->m_exception_ptr = p;
+                                        else
+                                            sync_request->copy_outputs_from_another_batch(request, b, size);
+                                    }
+                                    for (auto& t : batch_tasks) {
+                                        t.second();
+                                        on_completed();
                                     }
                                 });
+                            request->start_async();
+                        }
+                        for (; n < sz; n++) {
+                            auto& t = tasks[n];
+                            t.first->m_request_without_batch->set_callback([t, &on_completed](std::exception_ptr p) {
+                                if (p)
+                                    t.first->m_sync_request->m_exception_ptr = p;
+                                t.second();
+                                on_completed();
+                            });
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
                             t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
@@ -170,11 +252,20 @@ void CompiledModel::set_property(const ov::AnyMap& properties) {
         if (property.first == ov::auto_batch_timeout.name()) {
             m_time_out = property.second.as<std::uint32_t>();
             m_config[ov::auto_batch_timeout.name()] = property.second.as<std::uint32_t>();
+        } else if (property.first == ov::auto_batch::latency_budget.name()) {
+            m_latency_budget = property.second.as<std::uint32_t>();
+            m_config[ov::auto_batch::latency_budget.name()] = property.second.as<std::uint32_t>();
+            std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
+            for (const auto& w : m_worker_requests) {
+                w->_policy.set_latency_budget(std::chrono::milliseconds(m_latency_budget));
+            }
         } else {
             OPENVINO_THROW("AutoBatching Compiled Model dosen't support property",
                            property.first,
-                           ". The only property that can be changed on the fly is the ",
-                           ov::auto_batch_timeout.name());
+                           ". The only properties that can be changed on the fly are the ",
+                           ov::auto_batch_timeout.name(),
+                           " and the ",
+                           ov::auto_batch::latency_budget.name());
         }
     }
 }
@@ -212,10 +303,14 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch::latency_budget.name(), ov::PropertyMutability::RW}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == ov::auto_batch::latency_budget) {
+            uint32_t latency_budget = m_latency_budget;
+            return latency_budget;
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
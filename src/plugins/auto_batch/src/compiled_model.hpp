@@ -6,12 +6,15 @@
 #pragma once
 
 #include <condition_variable>
+#include <map>
 #include <thread>
 
+#include "adaptive_batching.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/thread_safe_containers.hpp"
 #include "plugin.hpp"
+#include "properties.hpp"
 
 namespace ov {
 namespace autobatch_plugin {
@@ -31,6 +34,10 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        AdaptiveBatchingPolicy _policy{std::chrono::milliseconds(0)};
+        AdaptiveBatchingPolicy::Clock::time_point _batch_start;
+        // the requests of the batches smaller than _batch_size (by the batch size) to execute the partial batches
+        std::map<int, ov::SoPtr<ov::IAsyncInferRequest>> _infer_requests_with_smaller_batch;
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -41,7 +48,8 @@ public:
                   const std::set<std::size_t>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const std::map<std::size_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_with_smaller_batch = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -72,13 +80,15 @@ protected:
     mutable std::mutex m_worker_requests_mutex;
 
     mutable std::atomic_size_t m_num_requests_created = {0};
-    std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    std::atomic<std::uint32_t> m_time_out = {0};        // in ms
+    std::atomic<std::uint32_t> m_latency_budget = {0};  // in ms, 0 means the fixed timeout collection
 
     const std::set<std::size_t> m_batched_inputs;
     const std::set<std::size_t> m_batched_outputs;
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+    const std::map<std::size_t, ov::SoPtr<ov::ICompiledModel>> m_compiled_models_with_smaller_batch;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
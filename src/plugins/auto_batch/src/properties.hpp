@@ -0,0 +1,23 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace auto_batch {
+/**
+ * @brief Latency budget (in ms) of a request submitted to the auto-batching, experimental plugin-specific property.
+ * A non-zero value enables the adaptive collection: a partially collected batch is executed as soon as waiting for the
+ * rest of the batch would exceed the budget (given the observed arrival rate and the batched execution latency), while
+ * the ov::auto_batch_timeout still bounds the waiting time. Zero (default) keeps the fixed timeout collection.
+ * The budget is set per compiled model rather than per request (the infer requests have no properties), since all the
+ * requests share it, the deadline of the oldest collected request is the one that bounds the batch.
+ * When set at the compilation, the plugin also compiles the power-of-two batches smaller than the device batch, so a
+ * partial batch runs split into these batches instead of one request at a time.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> latency_budget{"AUTO_BATCH_LATENCY_BUDGET"};
+}  // namespace auto_batch
+}  // namespace ov
@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "adaptive_batching.hpp"
+
+#include <gtest/gtest.h>
+
+using ov::autobatch_plugin::AdaptiveBatchingPolicy;
+using namespace std::chrono;
+
+TEST(AdaptiveBatchingPolicyTest, DisabledByZeroBudget) {
+    AdaptiveBatchingPolicy policy(milliseconds(0));
+    EXPECT_FALSE(policy.is_enabled());
+    policy.set_latency_budget(milliseconds(10));
+    EXPECT_TRUE(policy.is_enabled());
+}
+
+TEST(AdaptiveBatchingPolicyTest, FullBatchIsNotDelayed) {
+    AdaptiveBatchingPolicy policy(milliseconds(100));
+    const auto now = AdaptiveBatchingPolicy::Clock::now();
+    for (size_t i = 1; i <= 4; i++)
+        policy.on_arrival(i, now);
+    EXPECT_EQ(policy.wait_time(4, 4, milliseconds(1000), now), AdaptiveBatchingPolicy::Clock::duration::zero());
+}
+
+TEST(AdaptiveBatchingPolicyTest, WaitIsBoundedByBudgetAndTimeout) {
+    AdaptiveBatchingPolicy policy(milliseconds(50));
+    const auto now = AdaptiveBatchingPolicy::Clock::now();
+    policy.on_arrival(1, now);
+    EXPECT_EQ(policy.wait_time(1, 4, milliseconds(1000), now), milliseconds(50));
+    EXPECT_EQ(policy.wait_time(1, 4, milliseconds(20), now), milliseconds(20));
+    // the measured batch latency is reserved from the budget
+    policy.on_batch_completed(milliseconds(30));
+    EXPECT_EQ(policy.wait_time(1, 4, milliseconds(1000), now + milliseconds(10)), milliseconds(10));
+    // the budget of the oldest request is over
+    EXPECT_EQ(policy.wait_time(1, 4, milliseconds(1000), now + milliseconds(20)),
+              AdaptiveBatchingPolicy::Clock::duration::zero());
+}
+
+TEST(AdaptiveBatchingPolicyTest, SparseTrafficFlushesEarly) {
+    AdaptiveBatchingPolicy policy(milliseconds(100));
+    auto now = AdaptiveBatchingPolicy::Clock::now();
+    // requests arrive every 40ms, so 6 more requests can't be collected within the budget
+    policy.on_arrival(1, now);
+    now += milliseconds(40);
+    policy.on_arrival(2, now);
+    EXPECT_EQ(policy.wait_time(2, 8, milliseconds(1000), now), AdaptiveBatchingPolicy::Clock::duration::zero());
+    // while the only missing request is expected in time
+    EXPECT_EQ(policy.wait_time(7, 8, milliseconds(1000), now), milliseconds(60));
+}
+
+TEST(AdaptiveBatchingPolicyTest, FlushResetsDeadline) {
+    AdaptiveBatchingPolicy policy(milliseconds(50));
+    auto now = AdaptiveBatchingPolicy::Clock::now();
+    policy.on_arrival(1, now);
+    policy.on_flush();
+    EXPECT_EQ(policy.wait_time(0, 4, milliseconds(1000), now), milliseconds(1000));
+    now += milliseconds(10);
+    policy.on_arrival(1, now);
+    EXPECT_EQ(policy.wait_time(1, 4, milliseconds(1000), now), milliseconds(50));
+}
@@ -108,6 +108,30 @@ TEST_P(PluginCompileModelTest, PluginCompileModelWithRemoteContextTestCase) {
     OV_ASSERT_NO_THROW(m_plugin->compile_model(m_model, m_plugin_properities, m_remote_context));
 }
 
+TEST_P(PluginCompileModelTest, PluginCompileModelWithLatencyBudgetTestCase) {
+    m_model = ov::test::utils::make_multi_single_conv();
+    std::set<size_t> compiled_batches;
+    ON_CALL(*m_core,
+            compile_model(MatcherCast<const std::shared_ptr<const ov::Model>&>(_),
+                          MatcherCast<const std::string&>(_),
+                          _))
+        .WillByDefault([&](const std::shared_ptr<const ov::Model>& model, const std::string&, const ov::AnyMap&) {
+            compiled_batches.insert(model->input(0).get_shape()[0]);
+            return m_mock_compile_model;
+        });
+    auto properties = m_plugin_properities;
+    properties[ov::auto_batch::latency_budget.name()] = static_cast<uint32_t>(20);
+    OV_ASSERT_NO_THROW(m_plugin->compile_model(m_model, properties));
+
+    // besides the batch1 and the batchN ones, the power-of-two batches below the batchN are compiled
+    ASSERT_FALSE(compiled_batches.empty());
+    const auto max_batch = *compiled_batches.rbegin();
+    std::set<size_t> expected_batches{1, max_batch};
+    for (size_t batch = 2; batch < max_batch; batch *= 2)
+        expected_batches.insert(batch);
+    EXPECT_EQ(expected_batches, compiled_batches);
+}
+
 TEST_P(PluginCompileModelTest, PluginCompileModelBatchedModelTestCase) {
     m_model = ov::test::utils::make_conv_pool_relu_non_zero({1, 1, 32, 32});
     auto batch = ov::Dimension(5);
@@ -26,6 +26,10 @@ ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::heter
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
+    // the micro-batches are scheduled across the submodels by the synchronous request itself
+    if (m_infer_request->m_num_micro_batches > 1) {
+        return;
+    }
     m_pipeline.clear();
     for (auto&& request : m_infer_request->m_subrequests) {
         auto request_executor = std::make_shared<RequestExecutor>(request);
@@ -33,6 +33,14 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
                 }
             }
             modelDistributionPolicy = value.as<std::set<ov::hint::ModelDistributionPolicy>>();
+        } else if (ov::hetero::num_micro_batches == key) {
+            num_micro_batches = value.as<size_t>();
+            OPENVINO_ASSERT(num_micro_batches > 0,
+                            "Wrong value ",
+                            num_micro_batches,
+                            " for property key ",
+                            ov::hetero::num_micro_batches.name(),
+                            ". Expected a positive number");
         } else if (ov::cache_encryption_callbacks == key) {
             encryption_callbacks = value.as<EncryptionCallbacks>();
         } else {
@@ -48,6 +56,8 @@ ov::Any Configuration::get(const std::string& name) const {
         return {device_priorities};
     } else if (name == ov::hint::model_distribution_policy) {
         return {modelDistributionPolicy};
+    } else if (name == ov::hetero::num_micro_batches) {
+        return {num_micro_batches};
     } else {
         OPENVINO_THROW("Property was not found: ", name);
     }
@@ -60,7 +70,8 @@ std::vector<ov::PropertyName> Configuration::get_supported() const {
 
 ov::AnyMap Configuration::get_hetero_properties() const {
     return {{ov::device::priorities.name(), device_priorities},
-            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy}};
+            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy},
+            {ov::hetero::num_micro_batches.name(), num_micro_batches}};
 }
 
 ov::AnyMap Configuration::get_device_properties() const {
@@ -40,6 +40,8 @@ struct Configuration {
 
     EncryptionCallbacks encryption_callbacks;
 
+    size_t num_micro_batches = 1;
+
     ov::AnyMap device_properties;
 };
 }  // namespace hetero
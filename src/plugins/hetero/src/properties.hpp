@@ -17,5 +17,14 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  * @brief Read-only property showing number of compiled submodels
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
+
+/**
+ * @brief Number of micro-batches a batched inference is split into to overlap the execution of the submodels.
+ * Applies to the models whose inputs, outputs and submodel boundaries are dynamic in the batch (outermost) dimension
+ * only, and whose inputs and outputs have the layout with the batch ('N') at the first position, as the samples of the
+ * batch must be computed independently. Otherwise the submodels are executed sequentially. 1 (default) disables the
+ * micro-batch pipeline.
+ */
+static constexpr Property<size_t, PropertyMutability::RW> num_micro_batches{"HETERO_NUM_MICRO_BATCHES"};
 }  // namespace hetero
 }  // namespace ov
@@ -13,6 +13,8 @@
 #include "compiled_model.hpp"
 #include "itt.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/layout.hpp"
+#include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "plugin.hpp"
 #include "remote_tensor.hpp"
@@ -53,6 +55,204 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
         const auto& input_port = m_subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
         m_subrequests[submodel_idx_in]->set_tensor(input_port, temp_tensor_map[output_port]);
     }
+
+    if (compiled_model->m_cfg.num_micro_batches > 1 && m_subrequests.size() > 1) {
+        init_micro_batch_pipeline(compiled_model);
+    }
+}
+
+namespace {
+
+// the micro-batches are the slices of the outermost dimension, the rest of the shape must be known in advance
+bool is_micro_batchable(const ov::Output<const ov::Node>& port) {
+    const auto& shape = port.get_partial_shape();
+    if (shape.rank().is_dynamic() || shape.size() == 0 || shape[0].is_static() ||
+        port.get_element_type().bitwidth() % 8 != 0) {
+        return false;
+    }
+    return std::all_of(shape.begin() + 1, shape.end(), [](const ov::Dimension& dim) {
+        return dim.is_static();
+    });
+}
+
+// the slices of the outermost dimension may be inferred separately only if it is the batch, which the user declares
+// with the layout of the model inputs and outputs
+bool is_batch_outermost(const ov::Output<const ov::Node>& port) {
+    const auto layout = ov::layout::get_layout(port);
+    return ov::layout::has_batch(layout) && ov::layout::batch_idx(layout) == 0;
+}
+
+ov::Shape get_micro_batch_shape(const ov::Output<const ov::Node>& port, size_t micro_batch) {
+    auto shape = port.get_partial_shape();
+    shape[0] = static_cast<ov::Dimension::value_type>(micro_batch);
+    return shape.to_shape();
+}
+
+ov::SoPtr<ov::ITensor> get_micro_batch(const ov::SoPtr<ov::ITensor>& tensor, size_t idx, size_t micro_batch) {
+    ov::Coordinate begin(tensor->get_shape().size(), 0);
+    ov::Coordinate end(tensor->get_shape());
+    begin[0] = idx * micro_batch;
+    end[0] = begin[0] + micro_batch;
+    return {ov::make_tensor(tensor._ptr, begin, end), tensor._so};
+}
+
+}  // namespace
+
+void ov::hetero::InferRequest::init_micro_batch_pipeline(
+    const std::shared_ptr<const ov::hetero::CompiledModel>& compiled_model) {
+    const auto& mapping_info = compiled_model->m_mapping_info;
+    const auto get_input = [&](size_t submodel_idx, size_t port_idx) -> SubrequestPort {
+        return {submodel_idx, m_subrequests[submodel_idx]->get_compiled_model()->inputs()[port_idx]};
+    };
+    const auto get_output = [&](size_t submodel_idx, size_t port_idx) -> SubrequestPort {
+        return {submodel_idx, m_subrequests[submodel_idx]->get_compiled_model()->outputs()[port_idx]};
+    };
+
+    std::vector<SubrequestPort> inputs, outputs;
+    for (const auto& [submodel_idx, port_idx] : mapping_info._inputs_to_submodels_inputs) {
+        inputs.push_back(get_input(submodel_idx, port_idx));
+    }
+    for (const auto& [submodel_idx, port_idx] : mapping_info._outputs_to_submodels_outputs) {
+        outputs.push_back(get_output(submodel_idx, port_idx));
+    }
+    std::map<std::pair<size_t, size_t>, MicroBatchRing> rings;
+    for (const auto& [input, output] : mapping_info._submodels_input_to_prev_output) {
+        // the submodels are executed in the topological order
+        if (input.first <= output.first) {
+            return;
+        }
+        auto& ring = rings[output];
+        ring.output = get_output(output.first, output.second);
+        ring.consumers.push_back(get_input(input.first, input.second));
+        // the producer must not overwrite the micro-batch until the most distant consumer reads it
+        ring.tensors.resize(std::max(ring.tensors.size(), input.first - output.first + 1));
+    }
+
+    const auto is_port_micro_batchable = [](const SubrequestPort& port) {
+        return is_micro_batchable(port.second) && is_batch_outermost(port.second);
+    };
+    if (inputs.empty() || !std::all_of(inputs.begin(), inputs.end(), is_port_micro_batchable) ||
+        !std::all_of(outputs.begin(), outputs.end(), is_port_micro_batchable) ||
+        !std::all_of(rings.begin(), rings.end(), [](const auto& ring) {
+            return is_micro_batchable(ring.second.output.second);
+        })) {
+        return;
+    }
+    // the output of the model consumed by another submodel would need both the user tensor and the ring
+    for (const auto& ring : rings) {
+        if (std::find(outputs.begin(), outputs.end(), ring.second.output) != outputs.end()) {
+            return;
+        }
+    }
+
+    m_num_micro_batches = compiled_model->m_cfg.num_micro_batches;
+    m_micro_batch_inputs = std::move(inputs);
+    m_micro_batch_outputs = std::move(outputs);
+    for (auto& ring : rings) {
+        const auto& element_type = ring.second.output.second.get_element_type();
+        for (auto& tensor : ring.second.tensors) {
+            tensor = ov::SoPtr<ov::ITensor>(ov::make_tensor(element_type, ov::Shape{}), nullptr);
+        }
+        m_micro_batch_rings.push_back(std::move(ring.second));
+    }
+}
+
+bool ov::hetero::InferRequest::infer_micro_batches() {
+    if (m_num_micro_batches == 1) {
+        return false;
+    }
+
+    // the full tensors set by the user, the micro-batches are the views to them
+    std::vector<ov::SoPtr<ov::ITensor>> inputs, outputs;
+    for (const auto& [submodel_idx, port] : m_micro_batch_inputs) {
+        inputs.push_back(m_subrequests[submodel_idx]->get_tensor(port));
+    }
+    const auto batch = inputs.front()->get_shape()[0];
+    const auto micro_batch = batch / m_num_micro_batches;
+    for (const auto& input : inputs) {
+        if (std::dynamic_pointer_cast<ov::IRemoteTensor>(input._ptr) || !input->is_continuous() ||
+            input->get_shape()[0] != batch || micro_batch * m_num_micro_batches != batch || micro_batch == 0) {
+            return false;
+        }
+    }
+    for (const auto& [submodel_idx, port] : m_micro_batch_outputs) {
+        auto output = m_subrequests[submodel_idx]->get_tensor(port);
+        if (std::dynamic_pointer_cast<ov::IRemoteTensor>(output._ptr)) {
+            return false;
+        }
+        output->set_shape(get_micro_batch_shape(port, batch));
+        outputs.push_back(output);
+    }
+    for (auto& ring : m_micro_batch_rings) {
+        for (auto& tensor : ring.tensors) {
+            tensor->set_shape(get_micro_batch_shape(ring.output.second, micro_batch));
+        }
+    }
+
+    const auto bind = [&](size_t stage, size_t idx) {
+        auto& request = m_subrequests[stage];
+        for (size_t i = 0; i < m_micro_batch_inputs.size(); i++) {
+            if (m_micro_batch_inputs[i].first == stage) {
+                request->set_tensor(m_micro_batch_inputs[i].second, get_micro_batch(inputs[i], idx, micro_batch));
+            }
+        }
+        for (size_t i = 0; i < m_micro_batch_outputs.size(); i++) {
+            if (m_micro_batch_outputs[i].first == stage) {
+                request->set_tensor(m_micro_batch_outputs[i].second, get_micro_batch(outputs[i], idx, micro_batch));
+            }
+        }
+        for (const auto& ring : m_micro_batch_rings) {
+            const auto& tensor = ring.tensors[idx % ring.tensors.size()];
+            if (ring.output.first == stage) {
+                request->set_tensor(ring.output.second, tensor);
+            }
+            for (const auto& consumer : ring.consumers) {
+                if (consumer.first == stage) {
+                    request->set_tensor(consumer.second, tensor);
+                }
+            }
+        }
+    };
+
+    // The submodel k processes the micro-batch i - k at the step i, so the submodels run concurrently on the
+    // consecutive micro-batches
+    std::exception_ptr exception;
+    const auto num_stages = m_subrequests.size();
+    for (size_t step = 0; step < m_num_micro_batches + num_stages - 1 && !exception; step++) {
+        std::vector<size_t> started;
+        try {
+            for (size_t stage = 0; stage < num_stages; stage++) {
+                if (step >= stage && step - stage < m_num_micro_batches) {
+                    bind(stage, step - stage);
+                    m_subrequests[stage]->start_async();
+                    started.push_back(stage);
+                }
+            }
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        for (const auto& stage : started) {
+            try {
+                m_subrequests[stage]->wait();
+            } catch (...) {
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+    }
+
+    // restore the full tensors, so they are visible to the user
+    for (size_t i = 0; i < m_micro_batch_inputs.size(); i++) {
+        m_subrequests[m_micro_batch_inputs[i].first]->set_tensor(m_micro_batch_inputs[i].second, inputs[i]);
+    }
+    for (size_t i = 0; i < m_micro_batch_outputs.size(); i++) {
+        m_subrequests[m_micro_batch_outputs[i].first]->set_tensor(m_micro_batch_outputs[i].second, outputs[i]);
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    return true;
 }
 
 ov::hetero::InferRequest::~InferRequest() = default;
@@ -125,6 +325,9 @@ std::vector<ov::SoPtr<ov::IVariableState>> ov::hetero::InferRequest::query_state
 }
 
 void ov::hetero::InferRequest::infer() {
+    if (infer_micro_batches()) {
+        return;
+    }
     for (auto&& request : m_subrequests) {
         OPENVINO_ASSERT(request);
         request->infer();
@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 
+#include "openvino/core/node_output.hpp"
 #include "openvino/itt.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
@@ -50,8 +51,28 @@ private:
 
     ov::SoPtr<ov::IAsyncInferRequest> get_request(const ov::Output<const ov::Node>& port) const;
 
+    void init_micro_batch_pipeline(const std::shared_ptr<const ov::hetero::CompiledModel>& compiled_model);
+
+    bool infer_micro_batches();
+
     std::vector<ov::SoPtr<ov::IAsyncInferRequest>> m_subrequests;
     std::map<ov::Output<const ov::Node>, size_t> m_port_to_subrequest_idx;
+
+    // submodel index and port
+    using SubrequestPort = std::pair<size_t, ov::Output<const ov::Node>>;
+
+    // Tensors passing the micro-batches between the submodels. The producer writes the micro-batch i into the tensor
+    // i % tensors.size() while the consumers may still read the previous micro-batches from the other ones.
+    struct MicroBatchRing {
+        SubrequestPort output;
+        std::vector<SubrequestPort> consumers;
+        std::vector<ov::SoPtr<ov::ITensor>> tensors;
+    };
+
+    size_t m_num_micro_batches = 1;
+    std::vector<SubrequestPort> m_micro_batch_inputs;
+    std::vector<SubrequestPort> m_micro_batch_outputs;
+    std::vector<MicroBatchRing> m_micro_batch_rings;
 };
 
 }  // namespace hetero
@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <cctype>
+
+#include "common_test_utils/test_constants.hpp"
+#include "hetero_tests.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "properties.hpp"
+
+using namespace ov::hetero::tests;
+
+namespace {
+
+// Two dependent submodels with the dynamic batch, the user affinities place them on the different devices
+std::shared_ptr<ov::Model> create_model_with_batched_adds(const ov::Layout& layout) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::PartialShape{-1, 3, 2, 2});
+    param->set_friendly_name("input");
+    param->set_layout(layout);
+    auto const_value1 = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1, 3, 1, 1}, {1, 2, 3});
+    const_value1->set_friendly_name("const_val1");
+    auto add1 = std::make_shared<ov::op::v1::Add>(param, const_value1);
+    add1->set_friendly_name("add1");
+    auto const_value2 = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1, 3, 1, 1}, {4, 5, 6});
+    const_value2->set_friendly_name("const_val2");
+    auto add2 = std::make_shared<ov::op::v1::Add>(add1, const_value2);
+    add2->set_friendly_name("add2");
+    auto result = std::make_shared<ov::op::v0::Result>(add2);
+    result->set_friendly_name("res");
+    result->set_layout(layout);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+    for (const auto& node : {param->shared_from_this(), const_value1->shared_from_this(), add1->shared_from_this()}) {
+        node->get_rt_info()["affinity"] = std::string("MOCK0.0");
+    }
+    for (const auto& node : {const_value2->shared_from_this(), add2->shared_from_this(), result->shared_from_this()}) {
+        node->get_rt_info()["affinity"] = std::string("MOCK0.1");
+    }
+    return model;
+}
+
+}  // namespace
+
+class HeteroMicroBatchTests : public HeteroTests, public ::testing::WithParamInterface<std::string> {};
+
+TEST_P(HeteroMicroBatchTests, infer_micro_batches_matches_infer) {
+    const auto model = create_model_with_batched_adds(ov::Layout(GetParam()));
+    const ov::Shape shape{8, 3, 2, 2};
+    const auto input = create_and_fill_tensor(ov::element::i64, shape);
+
+    auto infer = [&](size_t num_micro_batches) {
+        auto compiled_model = core.compile_model(model,
+                                                 ov::test::utils::DEVICE_HETERO,
+                                                 {ov::hetero::num_micro_batches(num_micro_batches)});
+        EXPECT_EQ(2, compiled_model.get_property(ov::hetero::number_of_submodels));
+        auto infer_request = compiled_model.create_infer_request();
+        infer_request.set_input_tensor(input);
+        infer_request.infer();
+        // the second inference must not depend on the state left by the first one
+        infer_request.infer();
+        return infer_request.get_output_tensor();
+    };
+
+    const auto expected = infer(1);
+    const auto actual = infer(4);
+    ASSERT_EQ(shape, expected.get_shape());
+    ASSERT_EQ(shape, actual.get_shape());
+    const auto* input_data = input.data<const int64_t>();
+    const auto* expected_data = expected.data<const int64_t>();
+    const auto* actual_data = actual.data<const int64_t>();
+    const int64_t channel_shift[] = {1 + 4, 2 + 5, 3 + 6};
+    for (size_t i = 0; i < expected.get_size(); i++) {
+        ASSERT_EQ(input_data[i] + channel_shift[i / (shape[2] * shape[3]) % shape[1]], expected_data[i]) << "at " << i;
+        EXPECT_EQ(expected_data[i], actual_data[i]) << "at " << i;
+    }
+}
+
+// the micro-batches are used only for the batch at the first position, the other layouts are executed sequentially
+INSTANTIATE_TEST_SUITE_P(smoke_Hetero,
+                         HeteroMicroBatchTests,
+                         ::testing::Values("NCHW", "N...", "CNHW", "..."),
+                         [](const ::testing::TestParamInfo<std::string>& info) {
+                             std::string name = info.param;
+                             for (auto& c : name) {
+                                 if (!std::isalnum(static_cast<unsigned char>(c))) {
+                                     c = '_';
+                                 }
+                             }
+                             return name;
+                         });
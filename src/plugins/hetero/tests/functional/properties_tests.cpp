@@ -65,6 +65,13 @@ TEST_F(HeteroTests, set_property_ModelDistributionPolicy) {
     ASSERT_NO_THROW(value = core.get_property(ov::test::utils::DEVICE_HETERO, ov::hint::model_distribution_policy));
     ASSERT_EQ(model_policy, value);
 }
+
+TEST_F(HeteroTests, set_property_num_micro_batches) {
+    EXPECT_EQ(1, core.get_property(ov::test::utils::DEVICE_HETERO, ov::hetero::num_micro_batches));
+    core.set_property(ov::test::utils::DEVICE_HETERO, ov::hetero::num_micro_batches(4));
+    EXPECT_EQ(4, core.get_property(ov::test::utils::DEVICE_HETERO, ov::hetero::num_micro_batches));
+    EXPECT_THROW(core.set_property(ov::test::utils::DEVICE_HETERO, ov::hetero::num_micro_batches(0)), ov::Exception);
+}
 }  // namespace tests
 }  // namespace hetero
 }  // namespace ov
\ No newline at end of file
@@ -20,6 +20,9 @@ using GlobalExecutionIndex = std::unordered_map<std::shared_ptr<Node>, std::pair
 struct AllocationContext {
     std::vector<std::shared_ptr<Edge>> edges;
     GlobalExecutionIndex execIndex;
+    // the execution index range of the nodes, which may be executed out of the execIndex order (concurrently), so the
+    // lifetime of their memory is to be extended to the whole range
+    GlobalExecutionIndex concurrentExecIndex;
     std::vector<size_t> syncPoints;
 };
 
@@ -8,8 +8,10 @@
 #include <cstdint>
 #include <functional>
 #include <utility>
+#include <vector>
 
 #include "lru_cache.h"
+#include "sharded_lru_cache.h"
 
 namespace ov::intel_cpu {
 
@@ -18,6 +20,12 @@ public:
     enum class LookUpStatus : int8_t { Hit, Miss };
 
     virtual ~CacheEntryBase() = default;
+
+    /**
+     * @brief Accumulates the per shard lookup counters of the entry into stats (extending it if necessary).
+     * Entries without statistics support leave stats untouched.
+     */
+    virtual void collectStatistics([[maybe_unused]] std::vector<CacheShardStatistics>& stats) const {}
 };
 
 /**
@@ -37,6 +45,7 @@ public:
     using ResultType = std::pair<ValType, LookUpStatus>;
 
     explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    CacheEntry(size_t capacity, size_t numShards) : _impl(capacity, numShards) {}
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the
@@ -68,4 +77,26 @@ public:
     ImplType _impl;
 };
 
+/**
+ * @brief Thread safe version of the CacheEntry backed by the lock striped ShardedLruCache storage.
+ * Can be safely used from several streams at the same time.
+ */
+
+template <typename KeyType, typename ValType>
+class ShardedCacheEntry : public CacheEntry<KeyType, ValType, ShardedLruCache<KeyType, ValType>> {
+public:
+    ShardedCacheEntry(size_t capacity, size_t numShards)
+        : CacheEntry<KeyType, ValType, ShardedLruCache<KeyType, ValType>>(capacity, numShards) {}
+
+    void collectStatistics(std::vector<CacheShardStatistics>& stats) const override {
+        const auto shardStats = this->_impl.getStatistics();
+        if (stats.size() < shardStats.size()) {
+            stats.resize(shardStats.size());
+        }
+        for (size_t i = 0; i < shardStats.size(); ++i) {
+            stats[i] += shardStats[i];
+        }
+    }
+};
+
 }  // namespace ov::intel_cpu
@@ -5,9 +5,25 @@
 #include "multi_cache.h"
 
 #include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "cache_entry.h"
 
 namespace ov::intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+std::vector<CacheShardStatistics> MultiCache::getStatistics() const {
+    std::vector<CacheShardStatistics> result;
+    if (!isThreadSafe()) {
+        return result;
+    }
+    std::lock_guard<std::mutex> lock(_storageMutex);
+    for (const auto& item : _storage) {
+        item.second->collectStatistics(result);
+    }
+    return result;
+}
+
 }  // namespace ov::intel_cpu
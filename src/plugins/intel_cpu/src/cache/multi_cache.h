@@ -7,17 +7,33 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "cache_entry.h"
+#include "openvino/core/except.hpp"
 
 namespace ov::intel_cpu {
 
+/**
+ * @brief Marks the records of the KeyType as sharable between the streams of a compiled model.
+ * Such records are executed by several streams at the same time, so the values built for the key must be stateless
+ * (e.g. primitives or compiled kernels without any scratch buffers or other mutable data). Specialize it next to the
+ * key definition; the records of all the other key types are always stored per stream.
+ */
+template <typename KeyType>
+struct SharedBetweenStreams : std::false_type {};
+
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention This implementation IS NOT THREAD SAFE unless it is created with a non zero number of shards!
+ * In the sharded mode every entry is backed by the lock striped ShardedLruCache, so the same MultiCache instance may
+ * be shared between several streams. A per stream cache may refer to such a shared cache, in this case the records of
+ * the key types marked by SharedBetweenStreams are stored in the shared cache.
  */
 
 class MultiCache {
@@ -34,6 +50,31 @@ public:
      */
     explicit MultiCache(size_t capacity) : _capacity(capacity) {}
 
+    /**
+     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+     * @param numShards number of independently locked shards of each entry, zero means the thread unsafe single shard
+     * storage
+     */
+    MultiCache(size_t capacity, size_t numShards) : _capacity(capacity), _numShards(numShards) {}
+
+    /**
+     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+     * @param sharedCache thread safe cache used for the key types marked by SharedBetweenStreams, may be null
+     */
+    MultiCache(size_t capacity, std::shared_ptr<MultiCache> sharedCache)
+        : _capacity(capacity),
+          _sharedCache(std::move(sharedCache)) {
+        OPENVINO_ASSERT(!_sharedCache || _sharedCache->isThreadSafe(), "The shared cache must be thread safe");
+    }
+
+    MultiCache(const MultiCache& other)
+        : _capacity(other._capacity),
+          _numShards(other._numShards),
+          _sharedCache(other._sharedCache) {
+        std::lock_guard<std::mutex> lock(other._storageMutex);
+        _storage = other._storage;
+    }
+
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
      * nothing was found) using the key and the builder functor and adds the new record to the cache
@@ -47,18 +88,40 @@ public:
               typename BuilderType,
               typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
+        if constexpr (SharedBetweenStreams<KeyType>::value) {
+            if (_sharedCache) {
+                return _sharedCache->getOrCreate(key, std::move(builder));
+            }
+        }
+        if (isThreadSafe()) {
+            auto entry = getEntry<ShardedCacheEntry<KeyType, ValueType>>(_capacity, _numShards);
+            return entry->getOrCreate(key, std::move(builder));
+        }
+        auto entry = getEntry<EntryTypeT<KeyType, ValueType>>(_capacity);
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    [[nodiscard]] bool isThreadSafe() const noexcept {
+        return _numShards != 0;
+    }
+
+    /**
+     * @brief Returns the lookup counters of every shard summed over all the entries.
+     * @return vector of statistics indexed by the shard number, empty for the thread unsafe cache
+     */
+    [[nodiscard]] std::vector<CacheShardStatistics> getStatistics() const;
+
 private:
     template <typename T>
     size_t getTypeId();
-    template <typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template <typename EntryType, typename... Args>
+    std::shared_ptr<EntryType> getEntry(Args... args);
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    size_t _numShards = 0;
+    std::shared_ptr<MultiCache> _sharedCache = nullptr;
+    mutable std::mutex _storageMutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -68,13 +131,16 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template <typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template <typename EntryType, typename... Args>
+std::shared_ptr<EntryType> MultiCache::getEntry(Args... args) {
     size_t id = getTypeId<EntryType>();
+    std::unique_lock<std::mutex> lock(_storageMutex, std::defer_lock);
+    if (isThreadSafe()) {
+        lock.lock();
+    }
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        auto result = _storage.insert({id, std::make_shared<EntryType>(args...)});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
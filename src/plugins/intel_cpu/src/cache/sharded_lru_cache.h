@@ -0,0 +1,137 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "lru_cache.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Snapshot of the lookup counters of a single cache shard
+ */
+struct CacheShardStatistics {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    CacheShardStatistics& operator+=(const CacheShardStatistics& rhs) {
+        hits += rhs.hits;
+        misses += rhs.misses;
+        evictions += rhs.evictions;
+        return *this;
+    }
+};
+
+/**
+ * @brief Lock striped LRU cache. The key space is split between a number of shards by the key hash, each shard is an
+ * independent LruCache guarded by its own mutex, so concurrent lookups of different keys rarely contend.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @note The LRU policy is maintained per shard, so the eviction order is only approximately global.
+ * The capacity is evenly distributed between the shards (rounded up).
+ */
+
+template <typename Key, typename Value>
+class ShardedLruCache {
+public:
+    ShardedLruCache(size_t capacity, size_t numShards)
+        : _capacity(capacity),
+          _shards(numShards == 0 ? 1 : numShards) {
+        const size_t shardCapacity = (_capacity + _shards.size() - 1) / _shards.size();
+        for (auto& shard : _shards) {
+            shard = std::make_unique<Shard>(shardCapacity);
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key& key, const Value& val) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard._mutex);
+        if (shard._impl.put(key, val)) {
+            shard._evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key& key) {
+        auto& shard = getShard(key);
+        Value result;
+        {
+            std::lock_guard<std::mutex> lock(shard._mutex);
+            result = shard._impl.get(key);
+        }
+        if (result == Value()) {
+            shard._misses.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            shard._hits.fetch_add(1, std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    [[nodiscard]] size_t getNumShards() const noexcept {
+        return _shards.size();
+    }
+
+    /**
+     * @brief Returns the lookup counters of every shard
+     * @return vector of statistics indexed by the shard number
+     */
+    [[nodiscard]] std::vector<CacheShardStatistics> getStatistics() const {
+        std::vector<CacheShardStatistics> result(_shards.size());
+        for (size_t i = 0; i < _shards.size(); ++i) {
+            result[i].hits = _shards[i]->_hits.load(std::memory_order_relaxed);
+            result[i].misses = _shards[i]->_misses.load(std::memory_order_relaxed);
+            result[i].evictions = _shards[i]->_evictions.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : _impl(capacity) {}
+
+        std::mutex _mutex;
+        LruCache<Key, Value> _impl;
+        std::atomic<uint64_t> _hits{0};
+        std::atomic<uint64_t> _misses{0};
+        std::atomic<uint64_t> _evictions{0};
+    };
+
+    Shard& getShard(const Key& key) {
+        return *_shards[static_cast<size_t>(key.hash()) % _shards.size()];
+    }
+
+    size_t _capacity;
+    std::vector<std::unique_ptr<Shard>> _shards;
+};
+
+}  // namespace ov::intel_cpu
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "graph.h"
@@ -77,7 +78,8 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              Config cfg,
                              const bool loaded_from_cache,
-                             std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                             std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                             const ImportedPackedWeights::Ptr& packed_weights)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
@@ -86,6 +88,12 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_loaded_from_cache(loaded_from_cache),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
+    if (packed_weights) {
+        m_socketWeights.setImportedPacked(packed_weights);
+    }
+    if (m_cfg.rtCacheShards > 0 && m_cfg.rtCacheCapacity > 0) {
+        m_sharedParamsCache = std::make_shared<MultiCache>(m_cfg.rtCacheCapacity, m_cfg.rtCacheShards);
+    }
     const auto& core = m_plugin->get_core();
     OPENVINO_ASSERT(core, "Unable to get API version. Core is unavailable");
 
@@ -170,7 +178,12 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                                                                     std::move(sub_streams_table),
                                                                     sub_cfg.streamsRankTable[i]};
             m_sub_compiled_models.push_back(
-                std::make_shared<CompiledModel>(model, plugin, sub_cfg, loaded_from_cache, m_sub_memory_manager));
+                std::make_shared<CompiledModel>(model,
+                                                plugin,
+                                                sub_cfg,
+                                                loaded_from_cache,
+                                                m_sub_memory_manager,
+                                                packed_weights));
         }
     }
 }
@@ -207,7 +220,8 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                                                          isQuantizedFlag,
                                                          streamsExecutor,
                                                          cpuParallel,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_sharedParamsCache);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
@@ -411,11 +425,29 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::weights_path) {
         return static_cast<decltype(ov::weights_path)::value_type>("");
     }
+    if (name == ov::intel_cpu::cpu_runtime_cache_statistics) {
+        decltype(ov::intel_cpu::cpu_runtime_cache_statistics)::value_type statistics{{"HITS", {}},
+                                                                                    {"MISSES", {}},
+                                                                                    {"EVICTIONS", {}}};
+        if (m_sharedParamsCache) {
+            for (const auto& shard : m_sharedParamsCache->getStatistics()) {
+                statistics["HITS"].push_back(shard.hits);
+                statistics["MISSES"].push_back(shard.misses);
+                statistics["EVICTIONS"].push_back(shard.evictions);
+            }
+        }
+        return statistics;
+    }
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
 void CompiledModel::export_model(std::ostream& modelStream) const {
-    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE);
+    // the packed weights are not stored to the weightless blob as it is expected to be small
+    const bool weightless = m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE;
+    ModelSerializer serializer(modelStream,
+                               m_cfg.cacheEncrypt,
+                               weightless,
+                               weightless ? PackedWeightsList{} : m_socketWeights.getPacked());
     serializer << m_model;
 }
 
@@ -35,6 +35,24 @@ namespace ov::intel_cpu {
 using namespace ov::threading;
 using namespace dnnl::impl::cpu::x64;
 
+namespace {
+
+template <typename T>
+T parseIntegerProperty(const ov::Any& val, const std::string& key) {
+    try {
+        ov::Any value = val.as<std::string>();
+        return value.as<T>();
+    } catch (const ov::Exception&) {
+        OPENVINO_THROW("Wrong value ",
+                       val.as<std::string>(),
+                       " for property key ",
+                       key,
+                       ". Expected only integer numbers");
+    }
+}
+
+}  // namespace
+
 Config::Config() {
     CPU_DEBUG_CAP_ENABLE(applyDebugCapsProperties());
 
@@ -271,21 +289,33 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ". Supported values: bf16, f16, f32, undefined");
             }
         } else if (ov::intel_cpu::cpu_runtime_cache_capacity.name() == key) {
-            int val_i = -1;
-            try {
-                ov::Any value = val.as<std::string>();
-                val_i = value.as<int>();
-            } catch (const ov::Exception&) {
-                OPENVINO_THROW("Wrong value ",
-                               val.as<std::string>(),
-                               " for property key ",
-                               ov::intel_cpu::cpu_runtime_cache_capacity.name(),
-                               ". Expected only integer numbers");
-            }
+            const auto val_i = parseIntegerProperty<int>(val, ov::intel_cpu::cpu_runtime_cache_capacity.name());
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_runtime_cache_shards.name() == key) {
+            const auto val_i = parseIntegerProperty<int>(val, ov::intel_cpu::cpu_runtime_cache_shards.name());
+            // any negative value will be treated
+            // as zero that means per stream caches
+            rtCacheShards = std::max(val_i, 0);
+        } else if (ov::intel_cpu::dynamic_graph_concurrency.name() == key) {
+            const auto val_i = parseIntegerProperty<int>(val, ov::intel_cpu::dynamic_graph_concurrency.name());
+            // any value less than 1 will be treated
+            // as 1 that means sequential execution
+            dynamicGraphConcurrency = std::max(val_i, 1);
+        } else if (ov::intel_cpu::shape_infer_cache_capacity.name() == key) {
+            const auto val_i = parseIntegerProperty<int>(val, ov::intel_cpu::shape_infer_cache_capacity.name());
+            // any negative value will be treated
+            // as zero that means disabling the cache
+            shapeInferCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::kv_cache_resident_budget.name() == key) {
+            const auto val_i = parseIntegerProperty<int64_t>(val, ov::intel_cpu::kv_cache_resident_budget.name());
+            // any negative value will be treated
+            // as zero that means disabling the paging
+            kvCacheResidentBudget = static_cast<size_t>(std::max<int64_t>(val_i, 0));
+        } else if (ov::intel_cpu::snippets_brgemm_tuning_db.name() == key) {
+            snippetsBrgemmTuningDb = val.as<std::string>();
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -75,6 +75,11 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    size_t rtCacheShards = 0UL;
+    size_t dynamicGraphConcurrency = 1UL;
+    size_t shapeInferCacheCapacity = 0UL;
+    size_t kvCacheResidentBudget = 0UL;
+    std::string snippetsBrgemmTuningDb;
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
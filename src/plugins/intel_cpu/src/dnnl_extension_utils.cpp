@@ -306,8 +306,12 @@ bool DnnlExtensionUtils::isUnarySupportedAsPostOp([[maybe_unused]] Algorithm alg
 
 std::string DnnlExtensionUtils::computeWeightsStringHash(const std::shared_ptr<const IMemory>& memory,
                                                          const std::shared_ptr<DnnlMemoryDesc>& dstDesc) {
-    const auto desc_hash = dnnl::impl::primitive_hashing::get_md_hash(*dstDesc->getDnnlDesc().get());
+    const auto desc_hash = computeWeightsDescHash(dstDesc);
     return std::to_string(desc_hash) + "_" + std::to_string(reinterpret_cast<uint64_t>(memory->getData()));
 }
 
+uint64_t DnnlExtensionUtils::computeWeightsDescHash(const std::shared_ptr<DnnlMemoryDesc>& dstDesc) {
+    return dnnl::impl::primitive_hashing::get_md_hash(*dstDesc->getDnnlDesc().get());
+}
+
 }  // namespace ov::intel_cpu
@@ -130,6 +130,13 @@ public:
      */
     static std::string computeWeightsStringHash(const std::shared_ptr<const IMemory>& memory,
                                                 const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
+
+    /**
+     * @brief Computes the hash of the weights representation after repacking, it does not depend on the weights address
+     * @param dstDesc descriptor defining weights representation after repacking
+     * @return hash value
+     */
+    static uint64_t computeWeightsDescHash(const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
 };
 
 }  // namespace ov::intel_cpu
@@ -8,6 +8,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <utility>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -15,27 +16,67 @@
 
 namespace ov::intel_cpu {
 
+/**
+ * @brief Memory shared by the nodes of a graph for their temporary buffers.
+ * The scratch pad may be split into several lanes, each backed by its own memory block, so the nodes executed
+ * concurrently can be bound to different lanes. The lane is selected per thread with the LaneGuard.
+ * There is a single lane by default, the others are reserved by the graphs executing the nodes concurrently.
+ */
 class DnnlScratchPad {
-    MemoryBlockPtr blockPtr;
-    MemoryBlockWithReuse* baseBlockPtr = nullptr;
+    std::vector<MemoryBlockPtr> blockPtrs;
+    std::vector<MemoryBlockWithReuse*> baseBlockPtrs;
     dnnl::engine eng;
+    int numaNode;
+
+    static size_t& currentLane() {
+        static thread_local size_t lane = 0;
+        return lane;
+    }
 
 public:
-    explicit DnnlScratchPad(dnnl::engine eng, int numa_node = -1) : eng(std::move(eng)) {
-        auto baseMemoryBlock = std::make_unique<MemoryBlockWithReuse>(numa_node);
-        baseBlockPtr = baseMemoryBlock.get();
-        blockPtr = std::make_shared<DnnlMemoryBlock>(std::move(baseMemoryBlock));
+    class LaneGuard {
+    public:
+        explicit LaneGuard(size_t lane) : m_prevLane(currentLane()) {
+            currentLane() = lane;
+        }
+        ~LaneGuard() {
+            currentLane() = m_prevLane;
+        }
+
+        LaneGuard(const LaneGuard&) = delete;
+        LaneGuard& operator=(const LaneGuard&) = delete;
+
+    private:
+        size_t m_prevLane;
+    };
+
+    explicit DnnlScratchPad(dnnl::engine eng, int numa_node = -1) : eng(std::move(eng)), numaNode(numa_node) {
+        reserveLanes(1);
+    }
+
+    /**
+     * @brief Makes sure the scratch pad has at least the given number of lanes.
+     * Is expected to be called on the graph initialization, before any node of the graphs sharing the scratch pad is
+     * executed.
+     */
+    void reserveLanes(size_t lanes) {
+        while (blockPtrs.size() < lanes) {
+            auto baseMemoryBlock = std::make_unique<MemoryBlockWithReuse>(numaNode);
+            baseBlockPtrs.push_back(baseMemoryBlock.get());
+            blockPtrs.push_back(std::make_shared<DnnlMemoryBlock>(std::move(baseMemoryBlock)));
+        }
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
-        return std::make_shared<Memory>(eng, md, blockPtr);
+        return std::make_shared<Memory>(eng, md, blockPtrs[currentLane() % blockPtrs.size()]);
     }
 
     [[nodiscard]] size_t size() const {
-        if (baseBlockPtr) {
-            return baseBlockPtr->size();
+        size_t result = 0;
+        for (const auto* baseBlockPtr : baseBlockPtrs) {
+            result += baseBlockPtr->size();
         }
-        return 0;
+        return result;
     }
 };
 
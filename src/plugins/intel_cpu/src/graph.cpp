@@ -35,6 +35,7 @@
 #include "allocation_context.hpp"
 #include "cpu_memory.h"
 #include "cpu_types.h"
+#include "dnnl_scratch_pad.h"
 #include "edge.h"
 #include "graph_context.h"
 #include "graph_dumper.h"
@@ -561,10 +562,17 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    std::unordered_map<const Node*, size_t> scratchPadLanes;
+    for (size_t i = 0; i < m_executableLanes.size(); i++) {
+        scratchPadLanes[m_executableGraphNodes[i].get()] = m_executableLanes[i];
+    }
+
     for (const auto& node : graphNodes) {
         {
             OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, node->profiling.createPrimitive);
             DEBUG_LOG(*node);
+            auto lane = scratchPadLanes.find(node.get());
+            DnnlScratchPad::LaneGuard laneGuard(lane != scratchPadLanes.end() ? lane->second : 0);
             node->createPrimitive();
         }
 
@@ -915,6 +923,14 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
         if (exec2sync < 10 || parallel_get_max_threads() < 2) {
             status = Status::ReadyDynamicSeq;
         }
+
+        if (const auto capacity = getConfig().shapeInferCacheCapacity) {
+            for (const auto& node : m_executableGraphNodes) {
+                if (node->isDynamicNode()) {
+                    node->enableShapeInferCache(capacity);
+                }
+            }
+        }
     } else {
         status = Status::ReadyStatic;
     }
@@ -958,11 +974,143 @@ int Graph::RegisterToAllocationContext(int offset, AllocationContext& context) {
         context.execIndex[node] = {inputExecIndex, outputExecIndex};
     }
 
+    CreateDataflowSchedule(syncNodesInds, context);
+
     context.edges.insert(context.edges.end(), graphEdges.begin(), graphEdges.end());
 
     return offset - 1;
 }
 
+/**
+ * Splits the sync segments of a dynamic graph into waves of mutually independent nodes, so the nodes of a wave can be
+ * executed concurrently as soon as the shapes of the segment are resolved.
+ * The nodes, which may affect the memory of other nodes or have to be processed alone (sync nodes, memory state nodes,
+ * nodes with inner graphs and executable inplace nodes), form a barrier and are never executed concurrently.
+ * The execution indices of the nodes are kept intact. Instead, each node of a wave gets an execution index range in the
+ * allocation context, which covers its wave (and is monotonic over the waves), so the memory regions of the nodes,
+ * which may run at the same time, always overlap. As a consequence, once the schedule is created, the graph must
+ * always be executed in the wave order.
+ */
+void Graph::CreateDataflowSchedule(const std::vector<size_t>& syncNodesInds, AllocationContext& context) {
+    m_dataflowSchedule.clear();
+    m_executableLanes.clear();
+    if (!IsDynamic() || getConfig().dynamicGraphConcurrency < 2) {
+        return;
+    }
+#if OV_THREAD_USE_TBB
+    const size_t numLanes = getConfig().dynamicGraphConcurrency;
+#else
+    // the fallback for the threading without work stealing, where the parallel regions of the nodes executed inside a
+    // parallel region are serialized: the waves are executed in a single lane, i.e. the nodes run one after another
+    const size_t numLanes = 1;
+#endif
+
+    std::unordered_set<const Node*> executableNodes;
+    for (const auto& node : m_executableGraphNodes) {
+        executableNodes.insert(node.get());
+    }
+    const std::unordered_set<size_t> syncNodes(syncNodesInds.begin(), syncNodesInds.end());
+
+    auto isBarrier = [&](size_t graphIdx) {
+        const auto& node = graphNodes[graphIdx];
+        const auto& execIndex = context.execIndex.at(node);
+        return syncNodes.count(graphIdx) != 0 || execIndex.first != execIndex.second ||
+               any_of(node->getType(), Type::MemoryInput, Type::MemoryOutput) ||
+               (executableNodes.count(node.get()) != 0 && node->isInPlace());
+    };
+
+    // segment index and the dependency level inside the segment for each graph node
+    std::unordered_map<const Node*, std::pair<size_t, size_t>> nodeLevels;
+    // the range of the execution indices of the nodes of each wave of the current segment
+    std::vector<std::pair<int, int>> waveExecIndices;
+    std::vector<NodePtr> segmentNodes;
+    auto registerSegment = [&]() {
+        // the waves are executed in the order of the levels, so the range of a wave is extended to the preceding and
+        // the following waves ranges to stay monotonic: the wave starts not later than any following wave and finishes
+        // not earlier than any preceding one
+        for (size_t level = 1; level < waveExecIndices.size(); level++) {
+            waveExecIndices[level].second = std::max(waveExecIndices[level].second, waveExecIndices[level - 1].second);
+        }
+        for (size_t level = waveExecIndices.size(); level-- > 1;) {
+            waveExecIndices[level - 1].first = std::min(waveExecIndices[level - 1].first, waveExecIndices[level].first);
+        }
+        for (const auto& node : segmentNodes) {
+            context.concurrentExecIndex[node] = waveExecIndices[nodeLevels.at(node.get()).second];
+        }
+        waveExecIndices.clear();
+        segmentNodes.clear();
+    };
+
+    size_t segment = 0;
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto& node = graphNodes[i];
+        const bool barrier = isBarrier(i);
+        if (barrier) {
+            if (!segmentNodes.empty()) {
+                registerSegment();
+                segment++;
+            }
+            nodeLevels[node.get()] = {segment++, 0};
+            continue;
+        }
+
+        size_t level = 0;
+        for (size_t j = 0; j < node->getParentEdges().size(); j++) {
+            const auto parent = node->getParentEdgeAt(j)->getParent();
+            auto it = nodeLevels.find(parent.get());
+            if (it != nodeLevels.end() && it->second.first == segment) {
+                level = std::max(level, it->second.second + 1);
+            }
+        }
+        nodeLevels[node.get()] = {segment, level};
+
+        const int execIndex = context.execIndex.at(node).first;
+        if (waveExecIndices.size() <= level) {
+            waveExecIndices.resize(level + 1, {execIndex, execIndex});
+        }
+        waveExecIndices[level].first = std::min(waveExecIndices[level].first, execIndex);
+        waveExecIndices[level].second = std::max(waveExecIndices[level].second, execIndex);
+        segmentNodes.push_back(node);
+    }
+    if (!segmentNodes.empty()) {
+        registerSegment();
+    }
+
+    m_executableLanes.assign(m_executableGraphNodes.size(), 0);
+    m_dataflowSchedule.resize(m_executableSyncNodesInds.size());
+    size_t execIdx = 0;
+    for (size_t s = 0; s < m_executableSyncNodesInds.size(); s++) {
+        std::vector<size_t> order;
+        for (; execIdx < m_executableSyncNodesInds[s]; execIdx++) {
+            order.push_back(execIdx);
+        }
+        auto waveKey = [&](size_t idx) {
+            return nodeLevels.at(m_executableGraphNodes[idx].get());
+        };
+        std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+            return waveKey(lhs) < waveKey(rhs);
+        });
+
+        for (size_t begin = 0, end = 0; begin < order.size(); begin = end) {
+            while (end < order.size() && waveKey(order[end]) == waveKey(order[begin])) {
+                end++;
+            }
+            DataflowWave wave(std::min(numLanes, end - begin));
+            for (size_t k = begin; k < end; k++) {
+                const size_t lane = (k - begin) % wave.size();
+                wave[lane].push_back(m_executableGraphNodes[order[k]]);
+                m_executableLanes[order[k]] = lane;
+            }
+            m_dataflowSchedule[s].push_back(std::move(wave));
+        }
+    }
+
+    // the nodes of the concurrent lanes need separate scratch pads, which are allocated only for the dataflow schedule
+    for (const auto& scratchPad : m_context->getScratchPads()) {
+        scratchPad->reserveLanes(numLanes);
+    }
+}
+
 static void InitEdgeStatus(const std::vector<EdgePtr>& edges) {
     for (const auto& edge : edges) {
         edge->init();
@@ -1051,7 +1199,8 @@ static void ValidateEdgeClusters(const EdgeClusters& clusters, size_t remaining)
 
 static MemoryRegions FormMemoryRegions(const EdgeClusters& clusters,
                                        size_t remaining,
-                                       const GlobalExecutionIndex& globalExecIndex) {
+                                       const GlobalExecutionIndex& globalExecIndex,
+                                       const GlobalExecutionIndex& concurrentExecIndex) {
     auto isConstOutput = [](const EdgePtr& edge) {
         return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
     };
@@ -1090,6 +1239,13 @@ static MemoryRegions FormMemoryRegions(const EdgeClusters& clusters,
                                                                : globalExecIndex.at(parent).second;
             int e_finish = usesInOutMemoryMultipleTimes(child) ? globalExecIndex.at(child).second
                                                                : globalExecIndex.at(child).first;
+            // the nodes executed concurrently may produce / consume the memory at any moment of their execution range
+            if (auto it = concurrentExecIndex.find(parent); it != concurrentExecIndex.end()) {
+                e_start = std::min(e_start, it->second.first);
+            }
+            if (auto it = concurrentExecIndex.find(child); it != concurrentExecIndex.end()) {
+                e_finish = std::max(e_finish, it->second.second);
+            }
 
             auto&& desc = edge->getOriginalDesc();
 
@@ -1172,7 +1328,10 @@ static std::tuple<MemoryControl::MemorySolution, EdgeClusters, Graph::OutputMemo
     Graph::OutputMemoryBlocks outputNodesMemBlocks;
     std::tie(remaining, outputNodesMemBlocks) = AllocateDynamicOutputEdges(edgeClusters, remaining, outputNodes);
 
-    auto memoryRegions = FormMemoryRegions(edgeClusters, remaining, allocationContext.execIndex);
+    auto memoryRegions = FormMemoryRegions(edgeClusters,
+                                           remaining,
+                                           allocationContext.execIndex,
+                                           allocationContext.concurrentExecIndex);
 
     memoryControl->insert(memoryRegions, allocationContext.syncPoints);
     auto memoryBlocks = memoryControl->solve();
@@ -1369,16 +1528,23 @@ void Graph::InferStatic(SyncInferRequest* request, int numaId) {
 
 namespace {
 
+// the parameters of the node must be prepared using the scratch pad lane the node is executed on
+inline size_t getScratchPadLane(const std::vector<size_t>& executableLanes, size_t nodeIndx) {
+    return executableLanes.empty() ? 0 : executableLanes[nodeIndx];
+}
+
 class UpdateNodesSeq {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes, const std::vector<size_t>& executableLanes)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_executableLanes(executableLanes) {}
 
     void operator()(size_t stopIndx) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
                 node->updateShapes();
+                DnnlScratchPad::LaneGuard laneGuard(getScratchPadLane(m_executableLanes, prepareCounter));
                 node->updateDynamicParams();
             }
         }
@@ -1387,6 +1553,7 @@ public:
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    const std::vector<size_t>& m_executableLanes;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1398,8 +1565,9 @@ using UpdateNodes = UpdateNodesSeq;
 
 class UpdateNodesBase {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes, const std::vector<size_t>& executableLanes)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_executableLanes(executableLanes) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
@@ -1426,10 +1594,12 @@ public:
                 break;
             }
             while (local_counter < prepareCounter) {
-                const auto& node = m_executableGraphNodes[local_counter++];
+                const auto& node = m_executableGraphNodes[local_counter];
                 if (node->isDynamicNode()) {
+                    DnnlScratchPad::LaneGuard laneGuard(getScratchPadLane(m_executableLanes, local_counter));
                     node->updateDynamicParams();
                 }
+                local_counter++;
             }
         }
     }
@@ -1438,6 +1608,7 @@ protected:
     std::atomic<size_t> m_prepareCounter{0};
     std::atomic<bool> m_completion{false};
     std::vector<NodePtr>& m_executableGraphNodes;
+    const std::vector<size_t>& m_executableLanes;
 };
 
 // NOLINTBEGIN(misc-include-cleaner) tbb has multiple implicit includes, which are not supposed to be included directly
@@ -1629,12 +1800,36 @@ inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* r
     }
 }
 
+void Graph::ExecuteDataflowSegment(size_t segment, SyncInferRequest* request, int numaId) const {
+    for (const auto& wave : m_dataflowSchedule[segment]) {
+        auto executeLane = [&](size_t lane) {
+            DnnlScratchPad::LaneGuard laneGuard(lane);
+            for (const auto& node : wave[lane]) {
+                ExecuteNodeWithCatch(node, request, numaId);
+            }
+        };
+
+        if (wave.size() == 1) {
+            executeLane(0);
+        } else {
+            parallel_for(wave.size(), executeLane);
+        }
+    }
+}
+
 template <typename UpdateStrategy>
 void Graph::InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update) {
     size_t inferCounter = 0;
-    for (auto stopIndx : m_executableSyncNodesInds) {
+    for (size_t segment = 0; segment < m_executableSyncNodesInds.size(); segment++) {
+        const auto stopIndx = m_executableSyncNodesInds[segment];
         std::forward<UpdateStrategy>(update)(stopIndx);
 
+        if (!m_dataflowSchedule.empty()) {
+            ExecuteDataflowSegment(segment, request, numaId);
+            inferCounter = stopIndx;
+            continue;
+        }
+
         for (; inferCounter < stopIndx; ++inferCounter) {
             auto& node = m_executableGraphNodes[inferCounter];
 
@@ -1662,10 +1857,10 @@ void Graph::Infer(SyncInferRequest* request) {
 
     switch (status) {
     case Status::ReadyDynamic:
-        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes));
+        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes, m_executableLanes));
         break;
     case Status::ReadyDynamicSeq:
-        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes));
+        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes, m_executableLanes));
         break;
     case Status::ReadyStatic:
         InferStatic(request, numaId);
@@ -297,6 +297,8 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         m_executableSyncNodesInds.clear();
+        m_dataflowSchedule.clear();
+        m_executableLanes.clear();
     }
     Status status{Status::NotReady};
 
@@ -328,6 +330,7 @@ protected:
     void AllocateWithReuse(const std::vector<size_t>& syncNodesInds, GlobalExecutionIndex globalExecIndex);
     void CreatePrimitivesAndExecConstants() const;
     std::vector<size_t> CreateExecutionGraph();
+    void CreateDataflowSchedule(const std::vector<size_t>& syncNodesInds, AllocationContext& context);
 
     /**
      * Execute a given \p node within \p request using \p numaId
@@ -351,6 +354,7 @@ protected:
     void InferStatic(SyncInferRequest* request, int numaId);
     template <typename UpdateStrategy>
     void InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update);
+    void ExecuteDataflowSegment(size_t segment, SyncInferRequest* request, int numaId) const;
 
     friend std::shared_ptr<ov::Model> dump_graph_as_ie_ngraph_net(const Graph& graph);
 
@@ -372,6 +376,15 @@ private:
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
 
+    // Dataflow schedule of a dynamic graph (empty if the nodes are executed sequentially).
+    // For each sync segment it holds a sequence of waves, the nodes of a wave do not depend on each other and are
+    // distributed between the lanes, which are executed concurrently. Each lane uses its own scratch pad lane
+    using DataflowLane = std::vector<NodePtr>;
+    using DataflowWave = std::vector<DataflowLane>;
+    std::vector<std::vector<DataflowWave>> m_dataflowSchedule;
+    // scratch pad lane of each executable node
+    std::vector<size_t> m_executableLanes;
+
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
 };
@@ -4,8 +4,14 @@
 #include "graph_context.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <tuple>
 #include <utility>
 
 #include "cache/multi_cache.h"
@@ -13,7 +19,10 @@
 #include "cpu_parallel.hpp"
 #include "dnnl_scratch_pad.h"
 #include "memory_control.hpp"
+#include "nodes/kernels/scaled_attn/kv_cache_paging.hpp"
 #include "nodes/memory.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -22,16 +31,50 @@
 
 namespace ov::intel_cpu {
 
+namespace {
+
+constexpr size_t snippetsKernelCacheCapacity = 1024;
+constexpr size_t snippetsKernelCacheShards = 16;
+
+// The static snippets kernels depend on the subgraph body, the layouts and the precisions, which are all a part of the
+// cache key, so the kernels generated for one compiled model are reused by the other compiled models alive in the same
+// process, e.g. when the same model is compiled again. The kernels are not persisted, a new process generates them
+// again.
+// The lowering also depends on the inference precision, on the number of threads and on the Brgemm tuning database, so
+// the graphs which differ in them use separate caches.
+// The caches are owned by the graph contexts, so the kernels are released together with the last compiled model using
+// them.
+MultiCachePtr getSharedSnippetsKernelCache(const Config& config) {
+    using Key = std::tuple<ov::element::Type, int, std::string>;
+    static std::mutex mutex;
+    static std::map<Key, std::weak_ptr<MultiCache>> caches;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = caches.begin(); it != caches.end();) {
+        it = it->second.expired() ? caches.erase(it) : std::next(it);
+    }
+    auto& weakCache = caches[Key{config.inferencePrecision, parallel_get_max_threads(), config.snippetsBrgemmTuningDb}];
+    auto cache = weakCache.lock();
+    if (!cache) {
+        cache = std::make_shared<MultiCache>(snippetsKernelCacheCapacity, snippetsKernelCacheShards);
+        weakCache = cache;
+    }
+    return cache;
+}
+
+}  // namespace
+
 GraphContext::GraphContext(Config config,
                            WeightsSharing::Ptr w_cache,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
                            std::shared_ptr<CpuParallel> cpuParallel,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           MultiCachePtr sharedParamsCache)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
+      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity, std::move(sharedParamsCache))),
       m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
+      m_snippetsKernelCache(m_config.snippetsCacheCapacity > 0 ? getSharedSnippetsKernelCache(m_config) : nullptr),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
       m_cpuParallel(std::move(cpuParallel)),
@@ -58,6 +101,10 @@ GraphContext::GraphContext(Config config,
     if (!m_cpuParallel) {
         m_cpuParallel = std::make_shared<CpuParallel>(m_config.tbbPartitioner);
     }
+
+    if (m_config.kvCacheResidentBudget > 0) {
+        m_kvCachePaging = std::make_shared<ov::Extensions::Cpu::KVCachePaging>(m_config.kvCacheResidentBudget);
+    }
 }
 
 const dnnl::engine& GraphContext::getEngine() {
@@ -13,6 +13,7 @@
 #include "cpu_parallel.hpp"
 #include "dnnl_scratch_pad.h"
 #include "memory_control.hpp"
+#include "nodes/kernels/scaled_attn/kv_cache_paging.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "sub_memory_manager.hpp"
@@ -37,7 +38,8 @@ public:
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
                  std::shared_ptr<CpuParallel> cpuParallel = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 MultiCachePtr sharedParamsCache = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -55,6 +57,11 @@ public:
         return m_snippetsParamsCache;
     }
 
+    // nullptr if the snippets cache is disabled
+    [[nodiscard]] MultiCachePtr getSnippetsKernelCache() const {
+        return m_snippetsKernelCache;
+    }
+
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
         return m_rtScratchPads[m_numaNodeId];
     }
@@ -97,6 +104,11 @@ public:
         return m_auxiliaryNetworkMemoryControl;
     }
 
+    // nullptr if the KV cache resident budget is not set
+    [[nodiscard]] const std::shared_ptr<ov::Extensions::Cpu::KVCachePaging>& getKVCachePaging() const {
+        return m_kvCachePaging;
+    }
+
     void releaseMemory() const {
         m_auxiliaryNetworkMemoryControl->releaseMemory();
     }
@@ -114,9 +126,11 @@ private:
     Config m_config;
     // per NUMA node caches for sharing weights data
     WeightsSharing::Ptr m_weightsCache;
-    // primitive cache
+    // primitive cache, the stateless records of which may be stored in a cache shared by the streams
     MultiCachePtr m_rtParamsCache;
     MultiCachePtr m_snippetsParamsCache;
+    // static snippets kernels shared by the compiled models alive in the process
+    MultiCachePtr m_snippetsKernelCache;
     // global scratch pad
     DnnlScratchPadPtr m_rtScratchPad;
 
@@ -140,6 +154,8 @@ private:
     std::shared_ptr<NetworkMemoryControl> m_auxiliaryNetworkMemoryControl;
     // main memory control object, which is supposed to be globally reused
     MemoryControl::Ptr m_memoryControl;
+    // keeps the paged attention KV cache blocks of the stream under the resident budget
+    std::shared_ptr<ov::Extensions::Cpu::KVCachePaging> m_kvCachePaging;
 };
 
 }  // namespace ov::intel_cpu
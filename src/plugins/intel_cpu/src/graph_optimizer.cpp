@@ -11,6 +11,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <initializer_list>
 #include <limits>
 #include <list>
 #include <memory>
@@ -37,9 +38,11 @@
 #include "node.h"
 #include "nodes/bin_conv.h"
 #include "nodes/concat.h"
+#include "nodes/common/cpu_convert.h"
 #include "nodes/conv.h"
 #include "nodes/deconv.h"
 #include "nodes/eltwise.h"
+#include "nodes/embedding_bag.h"
 #include "nodes/fake_quantize.h"
 #include "nodes/fullyconnected.h"
 #include "nodes/input.h"
@@ -121,6 +124,11 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph& graph) {
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
 
+    // Must precede MergeConvertAndEltwise, which would merge the decompression Convert into the Subtract/Multiply
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndDecompression");
+    FuseEmbeddingBagAndDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "MergeConvertAndEltwise");
     MergeConvertAndEltwise(graph);
     graph.RemoveDroppedNodes();
@@ -912,6 +920,141 @@ void GraphOptimizer::FuseConvDeconvFCAndConvertOnWeights(Graph& graph) {
     }
 }
 
+void GraphOptimizer::FuseEmbeddingBagAndDecompression(Graph& graph) {
+    // Embedding tables are usually the largest constants of recommendation models, so instead of decompressing the
+    // whole table in advance, the embedding nodes consume the compressed table and decompress only the gathered rows:
+    //   f16/bf16 table -> Convert -> EmbeddingBag
+    //   i8/u8 table -> Convert -> [Subtract(zero point)] -> Multiply(scale) -> EmbeddingBag
+    // where the zero points and the scales are either per-row or scalar constants.
+
+    auto isSuitableConstantPathNode = [](const NodePtr& node) {
+        return node->isConstant() && node->getChildEdges().size() == 1 && node->getFusedWith().empty();
+    };
+    auto isSuitableConvert = [&](const NodePtr& node, const std::initializer_list<ov::element::Type>& srcPrecisions) {
+        return node->getType() == Type::Convert && isSuitableConstantPathNode(node) &&
+               std::find(srcPrecisions.begin(), srcPrecisions.end(), node->getOriginalInputPrecisionAtPort(0)) !=
+                   srcPrecisions.end() &&
+               node->getOriginalOutputPrecisionAtPort(0) == ov::element::f32;
+    };
+    auto isSuitableEltwise = [&](const NodePtr& node, Algorithm algorithm) {
+        return node->getType() == Type::Eltwise && node->getAlgorithm() == algorithm &&
+               node->getParentEdges().size() == 2 && isSuitableConstantPathNode(node) &&
+               node->getOriginalOutputPrecisionAtPort(0) == ov::element::f32;
+    };
+    auto getConstantInput = [](const NodePtr& constant) -> node::Input* {
+        auto* input = dynamic_cast<node::Input*>(constant.get());
+        return (input && input->isConstant() && input->getMemoryPtr()) ? input : nullptr;
+    };
+    // Reads per-row (or scalar) decompression values from the second input of the Eltwise, which may be compressed
+    // itself. The nodes of the path are appended to 'path' to be removed after the fusing.
+    auto readDecompressionValues =
+        [&](const NodePtr& eltwise, const VectorDims& tableDims, std::vector<NodePtr>& path) -> std::vector<float> {
+        auto valuesNode = eltwise->getParentEdgeAt(1)->getParent();
+        if (isSuitableConvert(valuesNode, {ov::element::f16, ov::element::bf16, ov::element::i8, ov::element::u8})) {
+            path.push_back(valuesNode);
+            valuesNode = valuesNode->getParentEdgeAt(0)->getParent();
+        }
+        const auto* input = getConstantInput(valuesNode);
+        if (!input) {
+            return {};
+        }
+        const auto& memory = input->getMemoryPtr();
+        const auto& dims = memory->getStaticDims();
+        const auto size = memory->getShape().getElementsCount();
+        const bool perRow = dims.size() == tableDims.size() && dims[0] == tableDims[0] &&
+                            std::all_of(dims.begin() + 1, dims.end(), [](size_t dim) {
+                                return dim == 1;
+                            });
+        if (size != 1 && !perRow) {
+            return {};
+        }
+        std::vector<float> values(size);
+        cpu_convert(memory->getData(), values.data(), memory->getPrecision(), ov::element::f32, size);
+        return values;
+    };
+
+    const auto& graphNodes = graph.GetNodes();
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto& embeddingBag = graphNodes[i];
+        if (none_of(embeddingBag->getType(),
+                    Type::EmbeddingBagOffsets,
+                    Type::EmbeddingBagPacked,
+                    Type::EmbeddingSegmentsSum)) {
+            continue;
+        }
+        auto* embeddingBagNode = dynamic_cast<EmbeddingBag*>(embeddingBag.get());
+        OPENVINO_ASSERT(embeddingBagNode, "Cannot cast ", embeddingBag->getName(), " to EmbeddingBag");
+
+        if (!embeddingBag->getInputShapeAtPort(0).isStatic()) {
+            continue;
+        }
+        const auto& tableDims = embeddingBag->getInputShapeAtPort(0).getDims();
+
+        std::vector<NodePtr> decompressionPath;
+        std::vector<float> scales;
+        std::vector<float> zeroPoints;
+        auto parent = embeddingBag->getParentEdgeAt(0)->getParent();
+
+        ov::element::Type tablePrecision;
+        if (isSuitableConvert(parent, {ov::element::f16, ov::element::bf16})) {
+            decompressionPath.push_back(parent);
+            tablePrecision = parent->getOriginalInputPrecisionAtPort(0);
+        } else if (isSuitableEltwise(parent, Algorithm::EltwiseMultiply)) {
+            decompressionPath.push_back(parent);
+            scales = readDecompressionValues(parent, tableDims, decompressionPath);
+            if (scales.empty()) {
+                continue;
+            }
+            parent = parent->getParentEdgeAt(0)->getParent();
+            if (isSuitableEltwise(parent, Algorithm::EltwiseSubtract)) {
+                decompressionPath.push_back(parent);
+                zeroPoints = readDecompressionValues(parent, tableDims, decompressionPath);
+                if (zeroPoints.empty()) {
+                    continue;
+                }
+                parent = parent->getParentEdgeAt(0)->getParent();
+            }
+            if (!isSuitableConvert(parent, {ov::element::i8, ov::element::u8})) {
+                continue;
+            }
+            decompressionPath.push_back(parent);
+            tablePrecision = parent->getOriginalInputPrecisionAtPort(0);
+        } else {
+            continue;
+        }
+
+        // The decompression must not broadcast the table
+        const auto allShapesMatch = std::all_of(decompressionPath.begin(),
+                                                decompressionPath.end(),
+                                                [&tableDims](const NodePtr& node) {
+                                                    return node->getType() != Type::Eltwise ||
+                                                           node->getOutputShapeAtPort(0).getDims() == tableDims;
+                                                });
+        const auto table = decompressionPath.back()->getParentEdgeAt(0)->getParent();
+        if (!allShapesMatch || !getConstantInput(table)) {
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseEmbeddingBagAndDecompression);
+
+        if (!scales.empty()) {
+            embeddingBagNode->fuseDecompression(std::move(scales), std::move(zeroPoints));
+        }
+        embeddingBag->setOriginalInputPrecisionAtPort(0, tablePrecision);
+
+        const auto tableEdge = decompressionPath.back()->getParentEdgeAt(0);
+        const auto inNum = tableEdge->getInputNum();
+        graph.RemoveEdge(embeddingBag->getParentEdgeAt(0));
+        for (const auto& node : decompressionPath) {
+            const auto parentEdges = node->getParentEdges();
+            for (const auto& edge : parentEdges) {
+                graph.RemoveEdge(edge.lock());
+            }
+        }
+        graph.CreateEdge(table, embeddingBag, inNum, 0);
+    }
+}
+
 void GraphOptimizer::FuseFCAndTransposeOnWeights(Graph& graph) {
     // This optimization allows us to avoid transposing the weights in Transpose node and do it directly along with
     // reordering in FC node
@@ -27,6 +27,7 @@
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "node.h"
+#include "nodes/kernels/scaled_attn/kv_cache_paging.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/node_output.hpp"
@@ -133,6 +134,11 @@ void SyncInferRequest::infer() {
 
     push_input_data(graph);
 
+    // the KV cache blocks of all the layers used by this inference are kept resident until the next one
+    if (const auto& paging = graph.getGraphContext()->getKVCachePaging()) {
+        paging->next_step();
+    }
+
     graph.Infer(this);
 
     throw_if_canceled();
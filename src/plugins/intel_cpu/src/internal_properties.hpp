@@ -6,8 +6,10 @@
 
 #include <cstdint>
 #include <istream>
+#include <map>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -20,6 +22,52 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Defines the number of lock striped shards of the CPU runtime parameters cache.
+ * Zero (default) means that every stream owns a private cache. Any positive value makes all the streams of a compiled
+ * model share a single thread safe cache, split into the given number of shards, for the stateless records (e.g. dnnl
+ * reorder primitives). The executors keeping scratch buffers or other state are always cached per stream.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_shards{"CPU_RUNTIME_CACHE_SHARDS"};
+
+/**
+ * @brief Per shard lookup counters of the shared CPU runtime parameters cache.
+ * The map contains "HITS", "MISSES" and "EVICTIONS" keys, each value is indexed by the shard number.
+ * All the vectors are empty if the cache is not shared (see cpu_runtime_cache_shards).
+ */
+static constexpr Property<std::map<std::string, std::vector<uint64_t>>, PropertyMutability::RO>
+    cpu_runtime_cache_statistics{"CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Defines the maximum number of independent branches of a dynamic graph that can be executed concurrently on
+ * the stream threads once their shapes are resolved. Values less than 2 keep the strict sequential execution order.
+ * Without the TBB threading the branches are scheduled the same way, but executed one after another.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> dynamic_graph_concurrency{"DYNAMIC_GRAPH_CONCURRENCY"};
+
+/**
+ * @brief Defines how many input shapes signatures are memorized per node of a dynamic graph, so the shape inference is
+ * skipped when a node gets the input shapes (and values of the data dependent inputs) it has already seen.
+ * Zero (default) disables the memorization.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> shape_infer_cache_capacity{"SHAPE_INFER_CACHE_CAPACITY"};
+
+/**
+ * @brief Defines the size in bytes of the paged attention KV cache blocks kept resident per stream. Once the blocks used
+ * by the recent inferences exceed the budget, the least recently used ones are paged out to the OS backing store (the
+ * swap or the file the cache tensors are mapped from) and prefetched back as soon as they appear in the block table.
+ * Zero (default) disables the paging.
+ */
+static constexpr Property<int64_t, PropertyMutability::RW> kv_cache_resident_budget{"KV_CACHE_RESIDENT_BUDGET"};
+
+/**
+ * @brief Defines the path to the tuning database of the snippets Brgemm blocking. When it is set, the block sizes of the
+ * static f32 Brgemms are selected by benchmarking the candidate blockings during the compilation, the winners are
+ * appended to the file and read from there by the next compilations on the same CPU.
+ * Empty (default) means that the block sizes are selected by the heuristic.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> snippets_brgemm_tuning_db{"SNIPPETS_BRGEMM_TUNING_DB"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -8,6 +8,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -69,7 +71,7 @@ private:
 
 class MemoryBlockWithRelease : public IMemoryBlockObserver {
 public:
-    MemoryBlockWithRelease() {
+    explicit MemoryBlockWithRelease(bool growGeometrically = false) : m_growGeometrically(growGeometrically) {
         auto pInternalMem = std::make_unique<MemoryBlockWithReuse>();
         m_pInternalMem = pInternalMem.get();
         m_pBlock = std::make_shared<DnnlMemoryBlock>(std::move(pInternalMem));
@@ -82,6 +84,11 @@ public:
         m_pBlock->setExtBuff(ptr, size);
     }
     bool resize(size_t size) override {
+        const size_t capacity = m_pInternalMem->size();
+        if (m_growGeometrically && size > capacity) {
+            // so that the subsequent shape changes mostly fit into the allocated block
+            size = std::max(size, capacity + capacity / 2);
+        }
         return m_pBlock->resize(size);
     }
     [[nodiscard]] bool hasExtBuffer() const noexcept override {
@@ -104,6 +111,7 @@ public:
 private:
     MemoryBlockPtr m_pBlock;
     MemoryBlockWithReuse* m_pInternalMem;
+    bool m_growGeometrically = false;
 };
 
 #ifdef CPU_DEBUG_CAPS
@@ -311,32 +319,41 @@ private:
     }
 #endif  // CPU_DEBUG_CAPS
 
+    // The boxes lifespans are compared on the original timeline with the infinite finish, so the groups formed
+    // by the previous solutions stay valid when new boxes are inserted
+    static int finishOf(const MemorySolver::Box& box) {
+        return -1 == box.finish ? std::numeric_limits<int>::max() : box.finish;
+    }
+
+    static bool overlap(const MemorySolver::Box& lhs, const MemorySolver::Box& rhs) {
+        return lhs.start <= finishOf(rhs) && rhs.start <= finishOf(lhs);
+    }
+
+    /**
+     * Incremental solution: only the boxes that have not been placed yet are assigned to a group, the already placed
+     * boxes keep their blocks, so the memory allocated for them so far is preserved
+     */
     void solve() {
-        ov::MemorySolver::normalize_boxes(m_boxes);
-
-        std::vector<std::vector<ov::MemorySolver::Box>> groups;  // groups of non overlapping boxes
-        groups.push_back({m_boxes.front()});
-        for (size_t i = 1; i < m_boxes.size(); ++i) {
-            const auto& box = m_boxes[i];
-            bool groupFound = false;
-            for (auto& group : groups) {
-                const auto& lastBox = group.back();
-                if (lastBox.start > box.finish || lastBox.finish < box.start) {
-                    group.push_back(box);
-                    groupFound = true;
-                    break;
-                }
-            }
+        std::vector<MemorySolver::Box> newBoxes;
+        std::copy_if(m_boxes.begin(), m_boxes.end(), std::back_inserter(newBoxes), [&](const MemorySolver::Box& box) {
+            return m_internalBlocks.count(box.id) == 0;
+        });
+        std::sort(newBoxes.begin(), newBoxes.end(), [](const MemorySolver::Box& l, const MemorySolver::Box& r) {
+            return l.start < r.start || (l.start == r.start && finishOf(l) < finishOf(r));
+        });
 
-            if (!groupFound) {
-                groups.push_back({box});
-            }
-        }
-        for (auto& group : groups) {
-            auto unique_block = std::make_shared<MemoryBlockWithRelease>();
-            for (auto& box : group) {
-                m_internalBlocks.insert({box.id, internalBlock(unique_block)});
+        for (const auto& box : newBoxes) {
+            auto it = std::find_if(m_groups.begin(), m_groups.end(), [&](const Group& group) {
+                return std::none_of(group.boxes.begin(), group.boxes.end(), [&](const MemorySolver::Box& item) {
+                    return overlap(item, box);
+                });
+            });
+            if (it == m_groups.end()) {
+                // the dynamic blocks are resized on the shape changes, so they grow geometrically
+                it = m_groups.insert(m_groups.end(), Group{{}, std::make_shared<MemoryBlockWithRelease>(true)});
             }
+            it->boxes.push_back(box);
+            m_internalBlocks.insert({box.id, internalBlock(it->block)});
         }
     }
 
@@ -353,8 +370,14 @@ private:
         return "MemoryManagerNonOverlappingSets";
     }
 
+    struct Group {
+        std::vector<MemorySolver::Box> boxes;  // non overlapping boxes sharing the block
+        std::shared_ptr<MemoryBlockWithRelease> block;
+    };
+
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
+    std::vector<Group> m_groups;
     std::unordered_map<MemoryControl::MemorySolution::key_type, std::shared_ptr<InternalBlock>> m_internalBlocks;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets& obj);)
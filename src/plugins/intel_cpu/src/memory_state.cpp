@@ -82,6 +82,21 @@ void VariableStateBase::set_state(const ov::SoPtr<ov::ITensor>& state) {
     reset_state_flag = false;
 }
 
+void VariableStateBase::set_state_from(const std::shared_ptr<ov::IVariableState>& source) {
+    OPENVINO_ASSERT(source, "Source variable state is not initialized");
+    auto cpu_source = std::dynamic_pointer_cast<IVariableState>(source);
+    if (cpu_source && cpu_source->is_reset_state()) {
+        reset();
+        return;
+    }
+    set_state_from_impl(source);
+    reset_state_flag = false;
+}
+
+void VariableStateBase::set_state_from_impl(const std::shared_ptr<ov::IVariableState>& source) {
+    set_state_impl(source->get_state());
+}
+
 ov::SoPtr<ov::ITensor> VariableStateBase::get_state() const {
     const auto& current_dims = internal_state_mem()->getStaticDims();
     auto current_ext_desc = m_external_desc->cloneWithNewDims(current_dims);
@@ -406,6 +421,42 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     }
     m_internal_mem_max_size = dense_internal_desc->getCurrentMemSize() / dense_internal_desc->getPrecision().size();
     m_hidden_state_max_size = mem_desc->getCurrentMemSize() / mem_desc->getPrecision().size();
+    m_internal_mem_shared = false;
+    m_hidden_state_shared = false;
+}
+
+void VariableStateKVcache::set_state_from_impl(const std::shared_ptr<ov::IVariableState>& source) {
+    auto kv_source = std::dynamic_pointer_cast<VariableStateKVcache>(source);
+    if (kv_source.get() == this) {
+        return;
+    }
+    auto can_share = [this](const VariableStateKVcache& other) {
+        return other.m_internal_mem && other.m_hidden_state &&
+               m_spec.alg != ov::internal::CacheQuantAlgorithm::TURBO && m_spec.alg == other.m_spec.alg &&
+               m_spec.precision == other.m_spec.precision && m_spec.group_size == other.m_spec.group_size &&
+               m_spec.by_channel == other.m_spec.by_channel &&
+               m_dense_internal_desc->getPrecision() == other.m_dense_internal_desc->getPrecision() &&
+               m_dense_internal_desc->getOrder() == other.m_dense_internal_desc->getOrder();
+    };
+    if (!kv_source || !can_share(*kv_source)) {
+        VariableStateBase::set_state_from_impl(source);
+        return;
+    }
+
+    // Share the source memory blocks by reference, while the own memory objects keep the descriptors independent.
+    // Neither of the states may update the shared memory in place from now on, so the SDPA node reallocates it
+    // copying the common prefix on the next write to either state
+    m_state = {};
+    auto share = [](const MemoryPtr& mem) {
+        return std::make_shared<Memory>(get_engine(), mem->getDescPtr(), mem->getMemoryBlock());
+    };
+    m_internal_mem = share(kv_source->m_internal_mem);
+    m_hidden_state = share(kv_source->m_hidden_state);
+    m_scale_zp = kv_source->m_scale_zp;
+    m_internal_mem_max_size = kv_source->m_internal_mem_max_size;
+    m_hidden_state_max_size = kv_source->m_hidden_state_max_size;
+    m_internal_mem_shared = kv_source->m_internal_mem_shared = true;
+    m_hidden_state_shared = kv_source->m_hidden_state_shared = true;
 }
 
 void VariableStateKVcache::reset_impl() {
@@ -434,6 +485,7 @@ MemoryPtr VariableStateKVcache::internal_state_mem() const {
 
 void VariableStateKVcache::assign_internal_state(const MemoryPtr& mem) {
     m_internal_mem = mem;
+    m_internal_mem_shared = false;
 }
 
 MemoryPtr VariableStateKVcache::hidden_state_mem() const {
@@ -442,5 +494,6 @@ MemoryPtr VariableStateKVcache::hidden_state_mem() const {
 
 void VariableStateKVcache::assign_hidden_state(const MemoryPtr& mem) {
     m_hidden_state = mem;
+    m_hidden_state_shared = false;
 }
 }  // namespace ov::intel_cpu
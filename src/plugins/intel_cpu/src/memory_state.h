@@ -39,6 +39,7 @@ public:
 
     // ov::IVariableState
     void set_state(const ov::SoPtr<ov::ITensor>& state) override final;
+    void set_state_from(const std::shared_ptr<ov::IVariableState>& source) override final;
     ov::SoPtr<ov::ITensor> get_state() const override;
     void reset() override final;
     bool is_reset_state() const override final;
@@ -49,6 +50,7 @@ protected:
     virtual void reset_impl() = 0;
     virtual void commit_impl() = 0;
     virtual void set_state_impl(const ov::SoPtr<ov::ITensor>& state);
+    virtual void set_state_from_impl(const std::shared_ptr<ov::IVariableState>& source);
 
     static MemoryDescPtr to_static(const MemoryDescPtr& desc);
     static const dnnl::engine& get_engine();
@@ -141,15 +143,16 @@ public:
     void assign_hidden_state(const MemoryPtr& mem);
 
     // size in elements count
+    // The memory shared with another state has no room to be updated in place, so it's copied on the next write
     size_t internal_state_max_size() const {
-        return m_internal_mem_max_size;
+        return m_internal_mem_shared ? 0 : m_internal_mem_max_size;
     }
     void assign_internal_state_max_size(size_t max_size) {
         m_internal_mem_max_size = max_size;
     }
 
     size_t hidden_state_max_size() const {
-        return m_hidden_state_max_size;
+        return m_hidden_state_shared ? 0 : m_hidden_state_max_size;
     }
     void assign_hidden_state_max_size(size_t max_size) {
         m_hidden_state_max_size = max_size;
@@ -169,6 +172,7 @@ public:
 private:
     // ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
+    void set_state_from_impl(const std::shared_ptr<ov::IVariableState>& source) override;
     void reset_impl() override;
     void commit_impl() override;
 
@@ -176,6 +180,9 @@ private:
     MemoryPtr m_hidden_state;  // beam access table
     size_t m_internal_mem_max_size = 0;
     size_t m_hidden_state_max_size = 0;
+    // the memory may be shared with the forked states (copy-on-write)
+    bool m_internal_mem_shared = false;
+    bool m_hidden_state_shared = false;
 
     // this desc stores the internal prc and axis permutation
     BlockedMemoryDescPtr m_dense_internal_desc;
@@ -47,6 +47,7 @@
 #include "openvino/util/pp.hpp"
 #include "partitioned_mem_blk.h"
 #include "selective_build.h"
+#include "shape_inference/shape_inference_caching.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
 #include "shape_inference/shape_inference_status.hpp"
 #include "transformations/rt_info/disable_precision_conversion.hpp"
@@ -1899,6 +1900,13 @@ IShapeInfer::Result Node::shapeInfer() const {
     return shapeInference->infer(input_shapes, input_values);
 }
 
+void Node::enableShapeInferCache(size_t capacity) {
+    if (!shapeInference || capacity == 0 || std::dynamic_pointer_cast<CachingShapeInfer>(shapeInference)) {
+        return;
+    }
+    shapeInference = std::make_shared<CachingShapeInfer>(shapeInference, capacity);
+}
+
 void Node::updateLastInputDims() {
     if (lastInputDims.size() != getParentEdges().size()) {
         OPENVINO_ASSERT(lastInputDims.empty(), "Input dims and parent edges number mismatch!");
@@ -810,6 +810,12 @@ protected:
     virtual bool needShapeInfer() const;
     std::vector<VectorDims> shapeInferGeneric(const std::vector<Shape>& shapes) const;
     virtual IShapeInfer::Result shapeInfer() const;
+    /**
+     * @brief Wraps the node shape inference into a cache, so the repeated input shapes are resolved without
+     * running the actual shape inference.
+     * @param capacity the maximum number of the memorized input shapes signatures
+     */
+    void enableShapeInferCache(size_t capacity);
 
     void execute(const dnnl::stream& strm, int numaId);
     virtual void execute(const dnnl::stream& strm) = 0;
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <type_traits>
 
 #include "cache/multi_cache.h"
 #include "common/primitive_hashing_utils.hpp"
@@ -39,6 +40,10 @@ bool ReorderKey::operator==(const ReorderKey& rhs) const {
     return retVal;
 }
 
+// dnnl primitives do not keep any state between executions, so a reorder may be executed by several streams at once
+template <>
+struct SharedBetweenStreams<ReorderKey> : std::true_type {};
+
 dnnl::reorder getReorderPrim(const MultiCachePtr& cache,
                              const dnnl::engine& engine,
                              const dnnl::memory::desc& src,
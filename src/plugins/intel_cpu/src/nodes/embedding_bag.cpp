@@ -4,19 +4,33 @@
 
 #include "embedding_bag.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "cpu_types.h"
+#include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "utils/general_utils.h"
+
+#if defined(OPENVINO_ARCH_X86_64)
+#    include "cpu/x64/cpu_isa_traits.hpp"
+#    include "nodes/kernels/x64/embedding_bag_kernel.hpp"
+#    include "nodes/kernels/x64/jit_kernel_base.hpp"
+#endif
 
 namespace ov::intel_cpu::node {
 
@@ -43,11 +57,103 @@ EmbeddingBag::EmbeddingBag(const std::shared_ptr<ov::Node>& op,
     }
 }
 
-void EmbeddingBag::prepareParams(const VectorDims& indexStaticShape) {
+#if defined(OPENVINO_ARCH_X86_64)
+// Number of indices the rows are prefetched ahead of the one being accumulated
+static constexpr size_t PREFETCH_DISTANCE = 8LU;
+
+static std::shared_ptr<kernel::JitKernelBase> createJitKernel(const kernel::jit_embedding_bag_compile_params& jcp) {
+    std::shared_ptr<kernel::JitKernelBase> res;
+
+    if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)) {
+        res = std::make_shared<kernel::jit_embedding_bag_kernel<dnnl::impl::cpu::x64::avx512_core>>(jcp);
+    } else if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+        res = std::make_shared<kernel::jit_embedding_bag_kernel<dnnl::impl::cpu::x64::avx2>>(jcp);
+    }
+
+    if (res) {
+        res->create_kernel();
+    }
+
+    return res;
+}
+#endif
+
+void EmbeddingBag::fuseDecompression(std::vector<float> scales, std::vector<float> zeroPoints) {
+    OPENVINO_ASSERT(!scales.empty(), "Layer EmbeddingBag with name '", _layerName, "' expects decompression scales");
+    _scales = std::move(scales);
+    _zeroPoints = std::move(zeroPoints);
+}
+
+bool EmbeddingBag::isF32Accumulation(const ov::element::Type& tablePrc) const {
+    return any_of(tablePrc, ov::element::f32, ov::element::bf16, ov::element::f16) ||
+           (any_of(tablePrc, ov::element::i8, ov::element::u8) && !_scales.empty());
+}
+
+std::pair<ov::element::Type, ov::element::Type> EmbeddingBag::getPrecisions(
+    const ov::element::Type& tablePrc,
+    const ov::element::Type& producedTablePrc) const {
+    if (any_of(tablePrc, ov::element::bf16, ov::element::f16)) {
+        // A table which is really stored in low precision (e.g. a compressed constant) is converted row by row instead
+        // of reordering the whole table to f32. The table requested in low precision only because of the inference
+        // precision is still consumed in f32.
+        if (producedTablePrc == tablePrc) {
+            return {tablePrc, ov::element::f32};
+        }
+        return {ov::element::f32, ov::element::f32};
+    }
+    if (isF32Accumulation(tablePrc)) {
+        return {tablePrc, ov::element::f32};
+    }
+    return {tablePrc, tablePrc};
+}
+
+impl_desc_type EmbeddingBag::getImplType([[maybe_unused]] const ov::element::Type& tablePrc) const {
+#if defined(OPENVINO_ARCH_X86_64)
+    if (isF32Accumulation(tablePrc)) {
+        if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)) {
+            return impl_desc_type::jit_avx512;
+        }
+        if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+            return impl_desc_type::jit_avx2;
+        }
+    }
+#endif
+    return impl_desc_type::ref_any;
+}
+
+void EmbeddingBag::prepareParams(const VectorDims& indexStaticShape,
+                                 [[maybe_unused]] const ov::element::Type& tablePrc) {
     _embDepth = 1LU;
     for (size_t i = 1LU; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+#if defined(OPENVINO_ARCH_X86_64)
+    const bool kernelApplicable =
+        isF32Accumulation(tablePrc) && _embDepth != 0LU &&
+        _embDepth * tablePrc.size() <= static_cast<size_t>(std::numeric_limits<int32_t>::max());
+    if (!kernelApplicable) {
+        _kernel.reset();
+        return;
+    }
+    if (_kernel && _kernelPrc == tablePrc && _kernelEmbDepth == _embDepth) {
+        return;
+    }
+
+    kernel::jit_embedding_bag_compile_params jcp;
+    jcp.src_prc = tablePrc;
+    jcp.emb_depth = _embDepth;
+    jcp.with_weights = _withWeights;
+    jcp.with_scales = !_scales.empty();
+    jcp.with_zero_points = !_zeroPoints.empty();
+    jcp.per_row_scales = _scales.size() > 1LU;
+    jcp.per_row_zero_points = _zeroPoints.size() > 1LU;
+    jcp.mean = _reduction == Reduction::MEAN;
+    jcp.prefetch_distance = PREFETCH_DISTANCE;
+    _kernel = createJitKernel(jcp);
+    _kernelPrc = tablePrc;
+    _kernelEmbDepth = _embDepth;
+#endif
 }
 
 template <typename T>
@@ -130,19 +236,129 @@ void EmbeddingBag::processData(const T* srcData,
     parallel_nt(0, threadBody);
 }
 
+template <typename T>
+void EmbeddingBag::processDataF32(const T* srcData,
+                                  const float* weightsData,
+                                  const VectorDims& inDataDims,
+                                  const MemoryPtr& outMemory) {
+    std::string msgPrefix = std::string("Node EmbeddingBag with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
+    auto* dstData = outMemory->getDataAs<float>();
+
+    const float* scales = _scales.empty() ? nullptr : _scales.data();
+    const float* zeroPoints = _zeroPoints.empty() ? nullptr : _zeroPoints.data();
+    const bool perRowScales = _scales.size() > 1LU;
+    const bool perRowZeroPoints = _zeroPoints.size() > 1LU;
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0LU);
+        size_t end(0LU);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end) {
+            return;
+        }
+
+        size_t indicesSize = 0LU;
+        const int* indices = nullptr;
+        size_t weightsIdx = 0LU;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            float* dst = dstData + obi * _embDepth;
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+
+            if (indices == nullptr) {
+                std::fill_n(dst, _embDepth, 0.0F);
+                continue;
+            }
+
+            withWeights = withWeights & _withWeights;
+            for (size_t inIdx = 0LU; inIdx < indicesSize; inIdx++) {
+                OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
+                                msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
+            }
+            const float* weights = withWeights ? weightsData + weightsIdx : nullptr;
+            const float dstScale = _reduction == Reduction::MEAN ? 1.0F / static_cast<float>(indicesSize) : 1.0F;
+
+#if defined(OPENVINO_ARCH_X86_64)
+            if (_kernel) {
+                kernel::jit_embedding_bag_call_args args{reinterpret_cast<const uint8_t*>(srcData),
+                                                         indices,
+                                                         weights,
+                                                         scales,
+                                                         zeroPoints,
+                                                         dst,
+                                                         indicesSize,
+                                                         dstScale};
+                (*_kernel)(&args);
+                continue;
+            }
+#endif
+
+            std::fill_n(dst, _embDepth, 0.0F);
+            for (size_t inIdx = 0LU; inIdx < indicesSize; inIdx++) {
+                const size_t row = indices[inIdx];
+                float factor = weights ? weights[inIdx] : 1.0F;
+                if (scales) {
+                    factor *= scales[perRowScales ? row : 0LU];
+                }
+                const float zeroPoint = zeroPoints ? zeroPoints[perRowZeroPoints ? row : 0LU] : 0.0F;
+                const T* src = srcData + row * _embDepth;
+                for (size_t i = 0LU; i < _embDepth; i++) {
+                    dst[i] += (static_cast<float>(src[i]) - zeroPoint) * factor;
+                }
+            }
+            if (_reduction == Reduction::MEAN) {
+                for (size_t i = 0LU; i < _embDepth; i++) {
+                    dst[i] *= dstScale;
+                }
+            }
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void EmbeddingBag::execute(const uint8_t* srcData,
                            const uint8_t* weightsData,
                            const ov::element::Type& srcPrc,
                            const VectorDims& inDims,
                            const MemoryPtr& outMemory) {
-    switch (srcPrc) {
-    case ov::element::f32: {
-        processData<element_type_traits<ov::element::f32>::value_type>(reinterpret_cast<const float*>(srcData),
-                                                                       reinterpret_cast<const float*>(weightsData),
-                                                                       inDims,
-                                                                       outMemory);
-        break;
+    if (isF32Accumulation(srcPrc)) {
+        const auto* weightsF32 = reinterpret_cast<const float*>(weightsData);
+        switch (srcPrc) {
+        case ov::element::f32: {
+            processDataF32(reinterpret_cast<const float*>(srcData), weightsF32, inDims, outMemory);
+            break;
+        }
+        case ov::element::bf16: {
+            processDataF32(reinterpret_cast<const ov::bfloat16*>(srcData), weightsF32, inDims, outMemory);
+            break;
+        }
+        case ov::element::f16: {
+            processDataF32(reinterpret_cast<const ov::float16*>(srcData), weightsF32, inDims, outMemory);
+            break;
+        }
+        case ov::element::i8: {
+            processDataF32(reinterpret_cast<const int8_t*>(srcData), weightsF32, inDims, outMemory);
+            break;
+        }
+        case ov::element::u8: {
+            processDataF32(srcData, weightsF32, inDims, outMemory);
+            break;
+        }
+        default: {
+            OPENVINO_THROW("EmbeddingBag layer does not support precision '" + std::string(srcPrc.get_type_name()) +
+                           "'");
+        }
+        }
+        return;
     }
+
+    switch (srcPrc) {
     case ov::element::i8: {
         processData<element_type_traits<ov::element::i8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                                                                       reinterpret_cast<const int8_t*>(weightsData),
@@ -8,12 +8,19 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "cpu_types.h"
+#include "onednn/iml_type_mapper.h"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type/element_type.hpp"
 
+namespace ov::intel_cpu::kernel {
+class JitKernelBase;
+}  // namespace ov::intel_cpu::kernel
+
 namespace ov::intel_cpu::node {
 
 class EmbeddingBag {
@@ -31,6 +38,12 @@ public:
                  const VectorDims& inDims,
                  const MemoryPtr& outMemory);
 
+    /**
+     * Fuses the dequantization of a constant i8/u8 embedding table, so every gathered row is reduced as
+     * (row - zeroPoints[rowIdx]) * scales[rowIdx]. A single scale (zero point) value is shared by all the rows.
+     */
+    void fuseDecompression(std::vector<float> scales, std::vector<float> zeroPoints);
+
     virtual ~EmbeddingBag() = default;
 
 protected:
@@ -41,10 +54,23 @@ protected:
                             size_t& weightsIdx,
                             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& indexStaticShape, const ov::element::Type& tablePrc);
+
+    // Returns the precision the embedding table is consumed in and the precision of the output and per sample weights.
+    // 'producedTablePrc' is the precision of the table at the output of its producer.
+    [[nodiscard]] std::pair<ov::element::Type, ov::element::Type> getPrecisions(
+        const ov::element::Type& tablePrc,
+        const ov::element::Type& producedTablePrc) const;
+    [[nodiscard]] impl_desc_type getImplType(const ov::element::Type& tablePrc) const;
 
     template <typename T>
     void processData(const T* srcData, const T* weightsData, const VectorDims& inDataDims, const MemoryPtr& outMemory);
+    // Reduces f32, f16, bf16 and decompressed i8/u8 tables into f32 output
+    template <typename T>
+    void processDataF32(const T* srcData,
+                        const float* weightsData,
+                        const VectorDims& inDataDims,
+                        const MemoryPtr& outMemory);
 
     const size_t EMB_TABLE_IDX = 0LU;
     const size_t INDICES_IDX;
@@ -55,6 +81,18 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+private:
+    [[nodiscard]] bool isF32Accumulation(const ov::element::Type& tablePrc) const;
+
+    std::vector<float> _scales;
+    std::vector<float> _zeroPoints;
+
+#if defined(OPENVINO_ARCH_X86_64)
+    std::shared_ptr<kernel::JitKernelBase> _kernel;
+    ov::element::Type _kernelPrc;
+    size_t _kernelEmbDepth = 0LU;
+#endif
 };
 
 }  // namespace ov::intel_cpu::node
@@ -28,7 +28,6 @@
 #include "openvino/op/embeddingbag_offsets_sum.hpp"
 #include "openvino/op/util/embeddingbag_offsets_base.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
-#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
@@ -81,20 +80,24 @@ void EmbeddingBagOffset::initSupportedPrimitiveDescriptors() {
     }
 
     static const std::set<ov::element::Type> supportedPrecisions = {ov::element::f32,
+                                                                    ov::element::bf16,
+                                                                    ov::element::f16,
                                                                     ov::element::i8,
                                                                     ov::element::u8,
                                                                     ov::element::i32};
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
-        inDataPrecision = ov::element::f32;
-    }
+    const auto& tableEdge = getParentEdgeAt(EMB_TABLE_IDX);
+    const auto [inDataPrecision, outDataPrecision] =
+        getPrecisions(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX),
+                      tableEdge->getParent()->getOriginalOutputPrecisionAtPort(tableEdge->getInputNum()));
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end()) {
             CPU_NODE_THROW("has unsupported precision: ", inDataPrecision.get_type_name());
         }
     } else {
         static const std::set<ov::element::Type> defaultSupportedPrecisions = {ov::element::f32,
+                                                                               ov::element::bf16,
+                                                                               ov::element::f16,
                                                                                ov::element::i8,
                                                                                ov::element::u8,
                                                                                ov::element::i32};
@@ -110,16 +113,17 @@ void EmbeddingBagOffset::initSupportedPrimitiveDescriptors() {
         inDataConfigurators.emplace_back(LayoutType::ncsp, ov::element::i32);
     }
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX) {
-        inDataConfigurators.emplace_back(LayoutType::ncsp, inDataPrecision);
+        inDataConfigurators.emplace_back(LayoutType::ncsp, outDataPrecision);
     }
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, outDataPrecision}}, getImplType(inDataPrecision));
 }
 
 void EmbeddingBagOffset::prepareParams() {
     _indicesLen = getParentEdgeAt(INDICES_IDX)->getMemory().getStaticDims()[0];
     _offsetsLen = getParentEdgeAt(OFFSETS_IDX)->getMemory().getStaticDims()[0];
-    EmbeddingBag::prepareParams(getParentEdgeAt(EMB_TABLE_IDX)->getMemory().getStaticDims());
+    const auto& tableMemory = getParentEdgeAt(EMB_TABLE_IDX)->getMemory();
+    EmbeddingBag::prepareParams(tableMemory.getStaticDims(), tableMemory.getPrecision());
 }
 
 void EmbeddingBagOffset::initFromInputs() {
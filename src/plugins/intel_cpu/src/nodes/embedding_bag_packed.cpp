@@ -28,7 +28,6 @@
 #include "openvino/op/embeddingbag_packedsum.hpp"
 #include "openvino/op/util/embeddingbag_packed_base.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
-#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
@@ -79,20 +78,24 @@ void EmbeddingBagPacked::initSupportedPrimitiveDescriptors() {
     }
 
     static const std::set<ov::element::Type> supportedPrecisions = {ov::element::f32,
+                                                                    ov::element::bf16,
+                                                                    ov::element::f16,
                                                                     ov::element::i8,
                                                                     ov::element::u8,
                                                                     ov::element::i32};
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
-        inDataPrecision = ov::element::f32;
-    }
+    const auto& tableEdge = getParentEdgeAt(EMB_TABLE_IDX);
+    const auto [inDataPrecision, outDataPrecision] =
+        getPrecisions(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX),
+                      tableEdge->getParent()->getOriginalOutputPrecisionAtPort(tableEdge->getInputNum()));
     if (!supportedPrecisions.empty()) {
         CPU_NODE_ASSERT(supportedPrecisions.find(inDataPrecision) != supportedPrecisions.end(),
                         "has unsupported precision: ",
                         inDataPrecision.get_type_name());
     } else {
         static const std::set<ov::element::Type> defaultSupportedPrecisions = {ov::element::f32,
+                                                                               ov::element::bf16,
+                                                                               ov::element::f16,
                                                                                ov::element::i8,
                                                                                ov::element::u8,
                                                                                ov::element::i32};
@@ -104,16 +107,17 @@ void EmbeddingBagPacked::initSupportedPrimitiveDescriptors() {
     std::vector<PortConfigurator> inDataConfigurators(
         {{LayoutType::ncsp, inDataPrecision}, {LayoutType::ncsp, ov::element::i32}});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX) {
-        inDataConfigurators.emplace_back(LayoutType::ncsp, inDataPrecision);
+        inDataConfigurators.emplace_back(LayoutType::ncsp, outDataPrecision);
     }
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, outDataPrecision}}, getImplType(inDataPrecision));
 }
 
 void EmbeddingBagPacked::prepareParams() {
     _batch = getParentEdgeAt(INDICES_IDX)->getMemory().getStaticDims()[0];
     _indicesPerBag = getParentEdgeAt(INDICES_IDX)->getMemory().getStaticDims()[1];
-    EmbeddingBag::prepareParams(getParentEdgeAt(EMB_TABLE_IDX)->getMemory().getStaticDims());
+    const auto& tableMemory = getParentEdgeAt(EMB_TABLE_IDX)->getMemory();
+    EmbeddingBag::prepareParams(tableMemory.getStaticDims(), tableMemory.getPrecision());
 }
 
 void EmbeddingBagPacked::initFromInputs() {
@@ -158,6 +158,38 @@ bool DnnlFCPrimitive::useWeightsDecompressionImpl(const ov::element::Type inputT
     return false;
 }
 
+// Weights quantized with finer groups than the configured dynamic quantization group (e.g. GGUF
+// Q6_K with group-16 scales against the default 32) would otherwise lose dynamic quantization:
+// the activation group must not straddle two weight groups. Shrink it to the weight group instead
+// when the kernels can still run it, i.e. the weight group is a multiple of the SIMD width.
+// Only the default group is adapted: the one set by the user via the hint is kept as is.
+static size_t fitDynamicQuantizationGroupSize(size_t dqGroupSize,
+                                              const MemoryDescPtr& weightsDesc,
+                                              const MemoryArgs& memory) {
+    const size_t simdWidth = 16;
+    if (dqGroupSize == 0 || dqGroupSize % simdWidth) {
+        return dqGroupSize;
+    }
+
+    const size_t ic = weightsDesc->getShape().getStaticDims()[1];
+    for (const auto arg : {ARG_WEI | ARG_ATTR_SCALES, ARG_WEI | ARG_ATTR_ZERO_POINTS}) {
+        auto it = memory.find(arg);
+        if (it == memory.end() || it->second->getShape().getRank() == 1) {
+            continue;
+        }
+        const auto groupsNum = it->second->getShape().getStaticDims()[1];
+        if (groupsNum <= 1 || ic % groupsNum) {
+            continue;
+        }
+        const size_t groupSize = ic / groupsNum;
+        if (groupSize < dqGroupSize && groupSize % simdWidth == 0 && dqGroupSize % groupSize == 0) {
+            dqGroupSize = groupSize;
+        }
+    }
+
+    return dqGroupSize;
+}
+
 static bool useDynamicQuantizationImpl(size_t dqGroupSize,
                                        const MemoryDescPtr& srcDesc,
                                        const MemoryDescPtr& weightsDesc,
@@ -244,7 +276,8 @@ static bool useDynamicQuantizationImpl(size_t dqGroupSize,
 static DnnlPrimitiveAttrs createPrimitiveAttrs(const FCAttrs& attrs,
                                                const MemoryArgs& memory,
                                                const ExecutorContext::CPtr& context,
-                                               bool useDynamicQuantization) {
+                                               bool useDynamicQuantization,
+                                               size_t dqGroupSize) {
     const auto& srcDesc = memory.at(ARG_SRC)->getDescPtr();
     const auto& weiDesc = memory.at(ARG_WEI)->getDescPtr();
     const auto& dstDesc = memory.at(ARG_DST)->getDescPtr();
@@ -295,7 +328,7 @@ static DnnlPrimitiveAttrs createPrimitiveAttrs(const FCAttrs& attrs,
                                                         !attrs.weightsNonTransposed,
                                                         ov::element::u8);
         }
-        dnnlpoc.setDynamicQuantizationParams(attrs.dynamicQuantizationGroupSize);
+        dnnlpoc.setDynamicQuantizationParams(dqGroupSize);
     }
 
     return dnnlpoc.compose();
@@ -431,11 +464,13 @@ DnnlShapeAgnosticDataPtr DnnlFCPrimitive::createShapeAgnosticData(const FCAttrs&
 
     const auto useWeightsDecompression =
         useWeightsDecompressionImpl(srcDesc->getPrecision(), weiDesc->getPrecision(), attrs.modelType);
+    const auto dqGroupSize = attrs.dynamicQuantizationGroupSizeSetExplicitly
+                                 ? attrs.dynamicQuantizationGroupSize
+                                 : fitDynamicQuantizationGroupSize(attrs.dynamicQuantizationGroupSize, weiDesc, memory);
     const auto useDynamicQuantization =
-        useWeightsDecompression &&
-        useDynamicQuantizationImpl(attrs.dynamicQuantizationGroupSize, srcDesc, weiDesc, memory);
+        useWeightsDecompression && useDynamicQuantizationImpl(dqGroupSize, srcDesc, weiDesc, memory);
 
-    const auto postOpData = createPrimitiveAttrs(attrs, memory, context, useDynamicQuantization);
+    const auto postOpData = createPrimitiveAttrs(attrs, memory, context, useDynamicQuantization, dqGroupSize);
 
     if (!cacheWeights) {
         return std::make_shared<DnnlShapeAgnosticData>(postOpData);
@@ -63,16 +63,28 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
         }
     }
 
+    // the source weights omitted from the compiled blob are read from their stored packed copy
+    MemoryPtr stored;
+    if (globalWeightCache && globalWeightCache->getImportedPacked()) {
+        stored = globalWeightCache->getImportedPacked()->find(weightsMem->getData(), eng, *dstWeightDesc);
+    }
+    const auto srcDesc = stored ? MemoryDescUtils::convertToDnnlMemoryDesc(stored->getDescPtr()) : srcWeightDesc;
+    auto* const srcData = stored ? stored->getData() : weightsMem->getData();
+
     auto create = [&]() {
+        if (stored && stored->getDesc().isCompatible(*dstWeightDesc)) {
+            return stored;
+        }
+
         // https://oneapi-src.github.io/oneDNN/dev_guide_int8_computations.html?highlight=128#inputs-of-the-same-type-s8
-        auto src_wdt = srcWeightDesc->getPrecision();
+        auto src_wdt = srcDesc->getPrecision();
         auto dst_wdt = dstWeightDesc->getPrecision();
         if (needShiftSignedToUnsigned && src_wdt.is_integral_number() && src_wdt.is_signed() &&
             dst_wdt.is_integral_number() && !dst_wdt.is_signed()) {
             assert(src_wdt.bitwidth() == dst_wdt.bitwidth());
 
             // prevent reorderData from doing conversion
-            Memory srcMemory{eng, srcWeightDesc->cloneWithNewPrecision(dst_wdt), weightsMem->getData()};
+            Memory srcMemory{eng, srcDesc->cloneWithNewPrecision(dst_wdt), srcData};
             MemoryPtr _ptr = std::make_shared<Memory>(eng, dstWeightDesc);
             node::Reorder::reorderData(srcMemory, *_ptr, rtCache, threadPool);
 
@@ -96,7 +108,7 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
             return _ptr;
         }
 
-        Memory srcMemory{eng, srcWeightDesc, weightsMem->getData()};
+        Memory srcMemory{eng, srcDesc, srcData};
         MemoryPtr _ptr = std::make_shared<Memory>(eng, dstWeightDesc);
         node::Reorder::reorderData(srcMemory, *_ptr, rtCache, threadPool);
 
@@ -105,9 +117,20 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
 
     MemoryPtr ptr;
     if (globalWeightCache && dnnl::memory::format_kind::blocked == dstWeightDesc->getDnnlDesc().get_format_kind()) {
+        // the packed weights replace their source in the compiled blob, so only the layout may differ from the source
+        const bool canReplaceSource = !needShiftSignedToUnsigned &&
+                                      srcDesc->getPrecision() == dstWeightDesc->getPrecision() &&
+                                      dstWeightDesc->hasEmptyExtraData();
+        auto createAndTrack = [&]() {
+            auto packed = create();
+            if (canReplaceSource) {
+                globalWeightCache->trackPacked(weightsMem, packed);
+            }
+            return packed;
+        };
         ptr = MemoryPtr(
             *globalWeightCache->findOrCreate(DnnlExtensionUtils::computeWeightsStringHash(weightsMem, dstWeightDesc),
-                                             create));
+                                             createAndTrack));
     } else {
         ptr = create();
     }
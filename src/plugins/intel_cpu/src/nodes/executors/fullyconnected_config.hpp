@@ -18,6 +18,8 @@ struct FCAttrs {
     bool weightsNonTransposed = false;
     bool sparseWeights = false;
     uint64_t dynamicQuantizationGroupSize = 0;
+    // the group size set by the user is kept as is, the default one may be shrunk to the weights groups
+    bool dynamicQuantizationGroupSizeSetExplicitly = false;
     bool constantWeights = true;
 
     ov::intel_cpu::Config::ModelType modelType = ov::intel_cpu::Config::ModelType::Unknown;
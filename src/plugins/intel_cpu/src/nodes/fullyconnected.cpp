@@ -575,6 +575,7 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
                                                         getOriginalInputPrecisionAtPort(DATA),
                                                         context->getConfig().fcSparseWeiDecompressionRate);
     attrs.dynamicQuantizationGroupSize = context->getConfig().fcDynamicQuantizationGroupSize;
+    attrs.dynamicQuantizationGroupSizeSetExplicitly = context->getConfig().fcDynamicQuantizationGroupSizeSetExplicitly;
     attrs.modelType = context->getConfig().modelType;
 
     attrs.dqScales = getDQScales();
@@ -41,6 +41,7 @@
 #include "shape_inference/shape_inference_pass_through.hpp"
 #include "transformations/cpu_opset/common/op/read_value_with_subgraph.hpp"
 #include "utils/general_utils.h"
+#include "weights_cache.hpp"
 
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
 #    include <xbyak/xbyak.h>
@@ -428,6 +429,14 @@ void Input::cloneBlobIfRequired() {
     const size_t size = shape.getElementsCount();
     CpuBlockedMemoryDesc memDesc(prec, shape);
 
+    // the constant refers to its packed copy stored in the compiled blob and is read only through the weights cache
+    if (const auto& weightCache = context->getWeightsCache();
+        weightCache && weightCache->getImportedPacked() &&
+        weightCache->getImportedPacked()->isSource(m_constOp->get_data_ptr())) {
+        memoryPtr = std::make_shared<Memory>(getEngine(), memDesc, m_constOp->get_data_ptr());
+        return;
+    }
+
     bool needFlushDenormalsToZero = true;
     if (context->getConfig().DAZOn) {
         // DAZ has been set, processor automatically converts all denormal source operands
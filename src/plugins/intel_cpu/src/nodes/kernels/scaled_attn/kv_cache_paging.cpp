@@ -0,0 +1,154 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache_paging.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include "openvino/core/except.hpp"
+#include "openvino/util/memory.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov::Extensions::Cpu {
+
+namespace {
+
+size_t page_size() {
+    static const auto size = static_cast<size_t>(ov::util::get_system_page_size());
+    return size;
+}
+
+}  // namespace
+
+size_t KVCachePaging::register_cache() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_caches.emplace_back();
+    return m_caches.size() - 1;
+}
+
+void KVCachePaging::next_step() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_step++;
+}
+
+void KVCachePaging::access(size_t slot,
+                           void* data,
+                           size_t num_blocks,
+                           size_t block_bytes,
+                           const int32_t* block_indices,
+                           size_t count) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    OPENVINO_ASSERT(slot < m_caches.size(), "KV cache slot ", slot, " is not registered");
+    auto& cache = m_caches[slot];
+    auto* bytes = static_cast<uint8_t*>(data);
+    if (cache.data != bytes || cache.blocks.size() != num_blocks || cache.block_bytes != block_bytes) {
+        // the cache tensor has been reallocated
+        reset_cache(cache, bytes, num_blocks, block_bytes);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const auto block = block_indices[i];
+        if (block >= 0 && static_cast<size_t>(block) < num_blocks) {
+            touch(slot, static_cast<size_t>(block));
+        }
+    }
+
+    // the blocks used by the current step are at the end of the list, they are never paged out
+    while (m_resident > m_budget && !m_lru.empty()) {
+        const auto id = m_lru.front();
+        if (m_caches[id.first].blocks[id.second].last_use == m_step) {
+            break;
+        }
+        page_out(id);
+    }
+}
+
+size_t KVCachePaging::resident_size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_resident;
+}
+
+size_t KVCachePaging::paged_out_blocks() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_paged_out;
+}
+
+bool KVCachePaging::is_resident(size_t slot, size_t block) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return slot < m_caches.size() && block < m_caches[slot].blocks.size() && m_caches[slot].blocks[block].resident;
+}
+
+void KVCachePaging::reset_cache(Cache& cache, uint8_t* data, size_t num_blocks, size_t block_bytes) {
+    for (auto& block : cache.blocks) {
+        if (block.resident) {
+            m_lru.erase(block.lru);
+            m_resident -= cache.block_bytes;
+        } else if (block.known) {
+            m_paged_out--;
+        }
+    }
+    cache.data = data;
+    cache.block_bytes = block_bytes;
+    cache.blocks.assign(num_blocks, Block{});
+}
+
+void KVCachePaging::touch(size_t slot, size_t block) {
+    auto& cache = m_caches[slot];
+    auto& item = cache.blocks[block];
+    if (item.last_use == m_step) {
+        return;
+    }
+    if (item.known && !item.resident) {
+        prefetch(block);
+    }
+    if (!item.resident) {
+        item.known = true;
+        item.resident = true;
+        item.lru = m_lru.insert(m_lru.end(), {slot, block});
+        m_resident += cache.block_bytes;
+    } else {
+        m_lru.splice(m_lru.end(), m_lru, item.lru);
+    }
+    item.last_use = m_step;
+}
+
+void KVCachePaging::prefetch(size_t block) {
+    for (size_t slot = 0; slot < m_caches.size(); slot++) {
+        auto& cache = m_caches[slot];
+        if (block >= cache.blocks.size() || !cache.blocks[block].known || cache.blocks[block].resident) {
+            continue;
+        }
+        auto& item = cache.blocks[block];
+        // the pages shared with the neighbour blocks are read back as well, which is harmless
+        const auto begin = reinterpret_cast<uintptr_t>(cache.data + block * cache.block_bytes);
+        const auto region = ov::util::align_region(begin, cache.block_bytes, page_size());
+        ov::util::vm_will_need(reinterpret_cast<void*>(region.m_address),
+                               ov::util::align_size_up(region.m_length, page_size()));
+        item.resident = true;
+        item.last_use = m_step;
+        item.lru = m_lru.insert(m_lru.end(), {slot, block});
+        m_resident += cache.block_bytes;
+        m_paged_out--;
+    }
+}
+
+void KVCachePaging::page_out(const BlockId& id) {
+    auto& cache = m_caches[id.first];
+    auto& item = cache.blocks[id.second];
+    item.resident = false;
+    m_lru.erase(item.lru);
+    m_resident -= cache.block_bytes;
+    m_paged_out++;
+    // only the pages that belong to the block entirely are paged out, not to slow down the neighbour blocks
+    const auto begin = reinterpret_cast<uintptr_t>(cache.data + id.second * cache.block_bytes);
+    const auto first_page = ov::util::align_size_up(begin, page_size());
+    const auto last_page = ov::util::align_size_down(begin + cache.block_bytes, page_size());
+    if (last_page > first_page) {
+        ov::util::vm_page_out(reinterpret_cast<void*>(first_page), last_page - first_page);
+    }
+}
+
+}  // namespace ov::Extensions::Cpu
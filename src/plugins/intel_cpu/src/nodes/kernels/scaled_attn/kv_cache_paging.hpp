@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ov::Extensions::Cpu {
+
+/**
+ * @brief Keeps the resident size of the paged attention KV cache blocks under the budget.
+ * The blocks live in the cache tensors owned by the caller, so they can't be moved to another storage without changing
+ * the block table. Instead, the least recently used blocks are paged out to the OS backing store (the swap or the file
+ * the cache tensors are mapped from), and the paged out blocks found in the block table are prefetched back in the
+ * background before the kernels walk it. A paged out block is prefetched in all the registered caches at once, since
+ * the layers share the block table, so the following layers find their blocks being read already.
+ */
+class KVCachePaging {
+public:
+    explicit KVCachePaging(size_t budget) : m_budget(budget) {}
+
+    /**
+     * @brief Registers a cache tensor (e.g. the key cache of a layer)
+     * @return the slot to pass to access()
+     */
+    size_t register_cache();
+
+    /**
+     * @brief Starts the next inference step. The blocks accessed within a step by any cache are not paged out until the
+     * following step starts, so the key and value caches of all the layers keep the blocks of the current step
+     */
+    void next_step();
+
+    /**
+     * @brief Marks the blocks as used by the current inference step, prefetches the paged out ones and pages out the
+     * least recently used blocks exceeding the budget
+     * @param slot the slot of the cache
+     * @param data the cache tensor data, the blocks are laid out contiguously along the outermost dimension
+     * @param num_blocks the number of blocks in the cache tensor
+     * @param block_bytes the size of a block in bytes
+     * @param block_indices the block table of the step
+     * @param count the number of the block indices
+     */
+    void access(size_t slot,
+                void* data,
+                size_t num_blocks,
+                size_t block_bytes,
+                const int32_t* block_indices,
+                size_t count);
+
+    [[nodiscard]] size_t resident_size() const;
+    [[nodiscard]] size_t paged_out_blocks() const;
+    [[nodiscard]] bool is_resident(size_t slot, size_t block) const;
+
+private:
+    using BlockId = std::pair<size_t, size_t>;  // slot, block
+
+    struct Block {
+        uint64_t last_use = 0;
+        bool known = false;
+        bool resident = false;
+        std::list<BlockId>::iterator lru;
+    };
+
+    struct Cache {
+        uint8_t* data = nullptr;
+        size_t block_bytes = 0;
+        std::vector<Block> blocks;
+    };
+
+    void reset_cache(Cache& cache, uint8_t* data, size_t num_blocks, size_t block_bytes);
+    void touch(size_t slot, size_t block);
+    void prefetch(size_t block);
+    void page_out(const BlockId& id);
+
+    mutable std::mutex m_mutex;
+    size_t m_budget;
+    size_t m_resident = 0;
+    size_t m_paged_out = 0;
+    uint64_t m_step = 1;  // the blocks which have never been used have the step 0
+    std::vector<Cache> m_caches;
+    std::list<BlockId> m_lru;  // the resident blocks, the least recently used first
+};
+
+}  // namespace ov::Extensions::Cpu
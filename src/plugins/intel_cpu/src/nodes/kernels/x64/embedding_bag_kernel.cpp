@@ -0,0 +1,239 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_kernel.hpp"
+
+#include <xbyak/xbyak.h>
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "emitters/plugin/x64/jit_load_store_emitters.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+using namespace dnnl::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace ov::intel_cpu::kernel {
+
+#define GET_OFF(field) offsetof(jit_embedding_bag_call_args, field)
+
+static constexpr size_t cache_line_size = 64;
+
+template <cpu_isa_t isa>
+void jit_embedding_bag_kernel<isa>::generate() {
+    OPENVINO_ASSERT(m_jcp.emb_depth != 0, "Embedding depth must be positive");
+    OPENVINO_ASSERT(!m_jcp.with_zero_points || m_jcp.with_scales, "Zero points are supported only with scales");
+
+    this->preamble();
+    mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+    mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+    mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+    mov(reg_scales, ptr[reg_params + GET_OFF(scales)]);
+    mov(reg_zero_points, ptr[reg_params + GET_OFF(zero_points)]);
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_indices_num, ptr[reg_params + GET_OFF(indices_num)]);
+
+    // The row is processed by column blocks of 'unroll' vectors, so every block keeps all its partial sums in registers
+    // while the rows referenced by the bag are streamed through.
+    const size_t block_size = unroll * vec_size;
+    const size_t blocks_num = m_jcp.emb_depth / block_size;
+    const size_t rest = m_jcp.emb_depth % block_size;
+    if (blocks_num != 0) {
+        mov(reg_blocks, blocks_num);
+        Label loop_blocks;
+        L(loop_blocks);
+        {
+            reduce_block(unroll, 0);
+            add(reg_src, block_size * m_jcp.src_prc.size());
+            add(reg_dst, block_size * sizeof(float));
+            dec(reg_blocks);
+            jnz(loop_blocks, T_NEAR);
+        }
+    }
+    if (rest != 0) {
+        reduce_block(rest / vec_size, rest % vec_size);
+    }
+
+    this->postamble();
+    for (const auto& emitter : emitters) {
+        if (emitter.second) {
+            emitter.second->emit_data();
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_embedding_bag_kernel<isa>::reduce_block(size_t vec_num, size_t tail_num) {
+    const size_t acc_num = vec_num + (tail_num != 0 ? 1 : 0);
+    for (size_t i = 0; i < acc_num; i++) {
+        uni_vpxor(vmm_acc(i), vmm_acc(i), vmm_acc(i));
+    }
+    if (m_jcp.with_zero_points) {
+        uni_vpxor(vmm_zp_sum, vmm_zp_sum, vmm_zp_sum);
+    }
+
+    if (m_jcp.with_weights) {
+        // Empty and default bags come without per sample weights
+        Label unweighted;
+        Label reduced;
+        test(reg_weights, reg_weights);
+        jz(unweighted, T_NEAR);
+        index_loop(vec_num, tail_num, true);
+        jmp(reduced, T_NEAR);
+        L(unweighted);
+        index_loop(vec_num, tail_num, false);
+        L(reduced);
+    } else {
+        index_loop(vec_num, tail_num, false);
+    }
+
+    // sum_k(f_k * (x_k - zp_k)) = sum_k(f_k * x_k) - sum_k(f_k * zp_k)
+    if (m_jcp.with_zero_points) {
+        for (size_t i = 0; i < acc_num; i++) {
+            uni_vsubps(vmm_acc(i), vmm_acc(i), vmm_zp_sum);
+        }
+    }
+    if (m_jcp.mean) {
+        uni_vbroadcastss(vmm_tmp, ptr[reg_params + GET_OFF(dst_scale)]);
+        for (size_t i = 0; i < acc_num; i++) {
+            uni_vmulps(vmm_acc(i), vmm_acc(i), vmm_tmp);
+        }
+    }
+    for (size_t i = 0; i < vec_num; i++) {
+        store(reg_dst, vmm_acc(i), vec_size, i * vec_size * sizeof(float));
+    }
+    if (tail_num != 0) {
+        store(reg_dst, vmm_acc(vec_num), tail_num, vec_num * vec_size * sizeof(float));
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_embedding_bag_kernel<isa>::index_loop(size_t vec_num, size_t tail_num, bool weighted) {
+    const size_t src_prc_size = m_jcp.src_prc.size();
+    const bool with_factor = weighted || m_jcp.with_scales;
+
+    xor_(reg_k, reg_k);
+    align(16);
+    Label loop_indices;
+    L(loop_indices);
+    {
+        movsxd(reg_idx, dword[reg_indices + reg_k * static_cast<int>(sizeof(int32_t))]);
+
+        if (weighted) {
+            uni_vbroadcastss(vmm_factor, ptr[reg_weights + reg_k * static_cast<int>(sizeof(float))]);
+            if (m_jcp.with_scales) {
+                uni_vbroadcastss(vmm_tmp, scale_ptr());
+                uni_vmulps(vmm_factor, vmm_factor, vmm_tmp);
+            }
+        } else if (m_jcp.with_scales) {
+            uni_vbroadcastss(vmm_factor, scale_ptr());
+        }
+        if (m_jcp.with_zero_points) {
+            uni_vbroadcastss(vmm_tmp, zero_point_ptr());
+            uni_vfmadd231ps(vmm_zp_sum, vmm_tmp, vmm_factor);
+        }
+
+        imul(reg_row, reg_idx, static_cast<int>(m_jcp.emb_depth * src_prc_size));
+        add(reg_row, reg_src);
+
+        if (m_jcp.prefetch_distance != 0) {
+            prefetch_row((vec_num * vec_size + tail_num) * src_prc_size);
+        }
+
+        auto accumulate = [&](const Vmm& vmm_acc) {
+            if (with_factor) {
+                uni_vfmadd231ps(vmm_acc, vmm_src, vmm_factor);
+            } else {
+                uni_vaddps(vmm_acc, vmm_acc, vmm_src);
+            }
+        };
+        for (size_t i = 0; i < vec_num; i++) {
+            load(vmm_src, reg_row, vec_size, i * vec_size * src_prc_size);
+            accumulate(vmm_acc(i));
+        }
+        if (tail_num != 0) {
+            load(vmm_src, reg_row, tail_num, vec_num * vec_size * src_prc_size);
+            accumulate(vmm_acc(vec_num));
+        }
+
+        inc(reg_k);
+        cmp(reg_k, reg_indices_num);
+        jl(loop_indices, T_NEAR);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_embedding_bag_kernel<isa>::prefetch_row(size_t block_bytes) {
+    // The indices are random accesses into a table which usually does not fit the caches, so the same column block
+    // of a row referenced 'prefetch_distance' indices later is requested in advance.
+    Label skip;
+    lea(reg_idx, ptr[reg_k + static_cast<int>(m_jcp.prefetch_distance)]);
+    cmp(reg_idx, reg_indices_num);
+    jge(skip, T_NEAR);
+    movsxd(reg_idx, dword[reg_indices + reg_idx * static_cast<int>(sizeof(int32_t))]);
+    imul(reg_idx, reg_idx, static_cast<int>(m_jcp.emb_depth * m_jcp.src_prc.size()));
+    add(reg_idx, reg_src);
+    for (size_t offset = 0; offset < block_bytes; offset += cache_line_size) {
+        prefetcht0(ptr[reg_idx + offset]);
+    }
+    L(skip);
+}
+
+template <cpu_isa_t isa>
+Address jit_embedding_bag_kernel<isa>::scale_ptr() const {
+    return m_jcp.per_row_scales ? ptr[reg_scales + reg_idx * static_cast<int>(sizeof(float))] : ptr[reg_scales];
+}
+
+template <cpu_isa_t isa>
+Address jit_embedding_bag_kernel<isa>::zero_point_ptr() const {
+    return m_jcp.per_row_zero_points ? ptr[reg_zero_points + reg_idx * static_cast<int>(sizeof(float))]
+                                     : ptr[reg_zero_points];
+}
+
+template <cpu_isa_t isa>
+void jit_embedding_bag_kernel<isa>::load(const Vmm& vmm_dst,
+                                         const Xbyak::Reg64& reg_src,
+                                         const int& elt_num,
+                                         size_t offset) {
+    const auto seed = load_emitter_params(m_jcp.src_prc, ov::element::f32, elt_num, true, "zero").hash();
+    if (!emitters[seed]) {
+        emitters[seed] = std::make_unique<jit_load_emitter>(this,
+                                                            isa,
+                                                            m_jcp.src_prc,
+                                                            ov::element::f32,
+                                                            elt_num,
+                                                            ov::element::f32,
+                                                            true,
+                                                            "zero");
+    }
+    emitters[seed]->emit_code({static_cast<size_t>(reg_src.getIdx()), offset},
+                              {static_cast<size_t>(vmm_dst.getIdx())},
+                              pool_aux_vmm_idxs,
+                              pool_aux_gpr_idxs);
+}
+
+template <cpu_isa_t isa>
+void jit_embedding_bag_kernel<isa>::store(const Xbyak::Reg64& reg_dst,
+                                          const Vmm& vmm_src,
+                                          const int& elt_num,
+                                          size_t offset) {
+    const auto seed = store_emitter_params(ov::element::f32, ov::element::f32, elt_num).hash();
+    if (!emitters[seed]) {
+        emitters[seed] = std::make_unique<jit_store_emitter>(this, isa, ov::element::f32, ov::element::f32, elt_num);
+    }
+    emitters[seed]->emit_code({static_cast<size_t>(vmm_src.getIdx())},
+                              {static_cast<size_t>(reg_dst.getIdx()), offset},
+                              pool_aux_vmm_idxs,
+                              pool_aux_gpr_idxs);
+}
+
+template struct jit_embedding_bag_kernel<cpu_isa_t::avx512_core>;
+template struct jit_embedding_bag_kernel<cpu_isa_t::avx2>;
+
+}  // namespace ov::intel_cpu::kernel
@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <xbyak/xbyak.h>
+
+#include <common/utils.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "emitters/plugin/x64/jit_emitter.hpp"
+#include "jit_kernel_base.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu::kernel {
+
+struct jit_embedding_bag_compile_params {
+    ov::element::Type src_prc;
+    size_t emb_depth = 0UL;
+    bool with_weights = false;
+    bool with_scales = false;
+    bool with_zero_points = false;
+    // false means that a single scale (zero point) is shared by all the rows of the table
+    bool per_row_scales = false;
+    bool per_row_zero_points = false;
+    bool mean = false;
+    // how many indices ahead of the current one the rows are prefetched
+    size_t prefetch_distance = 0UL;
+};
+
+// Reduces the rows of the embedding table referenced by one bag into one f32 output row:
+// dst = dst_scale * sum_k(weights[k] * scale[idx_k] * (src[idx_k] - zero_point[idx_k]))
+struct jit_embedding_bag_call_args {
+    const uint8_t* src;
+    const int32_t* indices;
+    const float* weights;  // nullptr for a bag without per sample weights
+    const float* scales;
+    const float* zero_points;
+    float* dst;
+    size_t indices_num;
+    float dst_scale;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_embedding_bag_kernel : public JitKernel<jit_embedding_bag_compile_params, jit_embedding_bag_call_args> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_embedding_bag_kernel)
+
+    static constexpr size_t vec_size = dnnl::impl::cpu::x64::cpu_isa_traits_t<isa>::vlen / sizeof(float);
+    static constexpr size_t unroll = 8;
+
+    explicit jit_embedding_bag_kernel(const jit_embedding_bag_compile_params& jcp)
+        : JitKernel(jit_name(), jcp, isa) {}
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                                         Xbyak::Xmm,
+                                                         isa == dnnl::impl::cpu::x64::avx2,
+                                                         Xbyak::Ymm,
+                                                         Xbyak::Zmm>::type;
+
+    void generate() override;
+    // Accumulates a column block of vec_num full vectors and tail_num trailing elements over all the indices of the bag
+    void reduce_block(size_t vec_num, size_t tail_num);
+    void index_loop(size_t vec_num, size_t tail_num, bool weighted);
+    void prefetch_row(size_t block_bytes);
+    void load(const Vmm& vmm_dst, const Xbyak::Reg64& reg_src, const int& elt_num, size_t offset = 0);
+    void store(const Xbyak::Reg64& reg_dst, const Vmm& vmm_src, const int& elt_num, size_t offset = 0);
+
+    [[nodiscard]] Xbyak::Address scale_ptr() const;
+    [[nodiscard]] Xbyak::Address zero_point_ptr() const;
+
+    // vmm_acc(0) ... vmm_acc(unroll - 1) are the accumulators
+    static Vmm vmm_acc(size_t i) {
+        return Vmm(static_cast<int>(i));
+    }
+    const Vmm vmm_src = Vmm(unroll);
+    const Vmm vmm_factor = Vmm(unroll + 1);
+    const Vmm vmm_tmp = Vmm(unroll + 2);
+    const Vmm vmm_zp_sum = Vmm(unroll + 3);
+
+    const Xbyak::Reg64 reg_params = abi_param1;
+    const Xbyak::Reg64 reg_src = r8;
+    const Xbyak::Reg64 reg_indices = r9;
+    const Xbyak::Reg64 reg_weights = r10;
+    const Xbyak::Reg64 reg_scales = r11;
+    const Xbyak::Reg64 reg_zero_points = r12;
+    const Xbyak::Reg64 reg_dst = r13;
+    const Xbyak::Reg64 reg_indices_num = r14;
+    const Xbyak::Reg64 reg_k = r15;
+    const Xbyak::Reg64 reg_row = rax;
+    const Xbyak::Reg64 reg_blocks = rbx;
+    const Xbyak::Reg64 reg_idx = rdx;
+
+    std::unordered_map<size_t, std::unique_ptr<jit_emitter>> emitters;
+    const std::vector<size_t> pool_aux_gpr_idxs = {static_cast<size_t>(rsi.getIdx()),
+                                                   static_cast<size_t>(rbp.getIdx())};
+    const std::vector<size_t> pool_aux_vmm_idxs = {unroll + 4};
+};
+
+}  // namespace ov::intel_cpu::kernel
@@ -20,6 +20,7 @@
 #include "node.h"
 #include "nodes/common/blocked_desc_creator.h"
 #include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
+#include "nodes/kernels/scaled_attn/kv_cache_paging.hpp"
 #include "nodes/node_config.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
@@ -318,6 +319,11 @@ void PagedAttention::createPrimitive() {
         CPU_NODE_THROW("AttentionExecutor creation fails with precision " + rtPrecision.to_string());
     }
     m_executor = result.first;
+
+    if (const auto& paging = context->getKVCachePaging()) {
+        m_kCachePagingSlot = paging->register_cache();
+        m_vCachePagingSlot = paging->register_cache();
+    }
 }
 
 void PagedAttention::execute([[maybe_unused]] const dnnl::stream& strm) {
@@ -408,6 +414,20 @@ void PagedAttention::execute([[maybe_unused]] const dnnl::stream& strm) {
         }
     }
 
+    if (const auto& paging = context->getKVCachePaging()) {
+        const auto& blockIndices = inputs[PagedAttentionExecutor::ID_BLOCK_INDICES];
+        const auto* blocks = blockIndices->getDataAs<const int32_t>();
+        const auto blockCount = blockIndices->getShape().getElementsCount();
+        auto access = [&](const MemoryPtr& cacheMem, size_t slot) {
+            const auto numBlocks = cacheMem->getStaticDims()[0];
+            if (numBlocks > 0) {
+                paging->access(slot, cacheMem->getData(), numBlocks, cacheMem->getSize() / numBlocks, blocks, blockCount);
+            }
+        };
+        access(inputs[PagedAttentionExecutor::ID_KCACHE], m_kCachePagingSlot);
+        access(inputs[PagedAttentionExecutor::ID_VCACHE], m_vCachePagingSlot);
+    }
+
     m_executor->execute(inputs, outputs, m_write_kv_cache);
 }
 
@@ -65,6 +65,9 @@ private:
     bool m_hasScore = false;
     bool m_has_adaptive_rkv_diversity_output = false;
     bool m_write_kv_cache = true;
+    // the slots of the key and value caches in the KV cache paging, if enabled
+    size_t m_kCachePagingSlot = 0;
+    size_t m_vCachePagingSlot = 0;
 };
 
 }  // namespace ov::intel_cpu::node
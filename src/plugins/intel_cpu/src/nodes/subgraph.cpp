@@ -100,6 +100,7 @@
 #    include "transformations/snippets/x64/pass/eliminate_brgemm_copy_b.hpp"
 #    include "transformations/snippets/x64/pass/fuse_brgemm_cpu_postops.hpp"
 #    include "transformations/snippets/x64/pass/lowered/adjust_brgemm_copy_b_loop_ports.hpp"
+#    include "transformations/snippets/x64/pass/lowered/brgemm_blocking_tuner.hpp"
 #    include "transformations/snippets/x64/pass/lowered/brgemm_cpu_blocking.hpp"
 #    include "transformations/snippets/x64/pass/lowered/insert_brgemm_copy_buffers.hpp"
 #    include "transformations/snippets/x64/pass/lowered/parallelize_gated_mlp_n_loops.hpp"
@@ -725,9 +726,14 @@ Subgraph::getControlFlowPasses() {  // NOLINT(readability-convert-member-functio
 #    define SNIPPETS_REGISTER_PASS_RELATIVE_RISCV64(PASS_PLACE, TARGET_PASS, PASS, ...)
 #endif  // OPENVINO_ARCH_RISCV64
 
-    SNIPPETS_REGISTER_PASS_RELATIVE_X86_64(Place::After,
-                                           ov::snippets::lowered::pass::MarkLoops,
-                                           ov::intel_cpu::pass::BrgemmCPUBlocking);
+#if defined(OPENVINO_ARCH_X86_64)
+    const auto& tuning_db = context->getConfig().snippetsBrgemmTuningDb;
+    SNIPPETS_REGISTER_PASS_RELATIVE_X86_64(
+        Place::After,
+        ov::snippets::lowered::pass::MarkLoops,
+        ov::intel_cpu::pass::BrgemmCPUBlocking,
+        tuning_db.empty() ? nullptr : ov::intel_cpu::pass::BrgemmBlockingTuner::get(tuning_db));
+#endif
     SNIPPETS_REGISTER_PASS_RELATIVE_ARM64(Place::After,
                                           ov::snippets::lowered::pass::MarkLoops,
                                           ov::intel_cpu::pass::GemmCPUBlocking);
@@ -930,10 +936,13 @@ void Subgraph::prepareParams() {
         }  // Static case:
         // 1. Update runtime config to get static scheduling data (io data offsets, parallel domain) which will be
         // compiled in JIT code
-        // 2. Generate JIT code with this static data if needed
+        // 2. Generate JIT code with this static data if needed. The static kernel executors are not updated after
+        //    the generation, so the code is taken from the kernel cache shared with the other compiled models.
+        //    The dynamic code stays in the graph cache since its kernel executor table is updated at runtime.
         // 3. Create SubgraphStaticExecutor
         const auto& snippet_config = ov::as_type_ptr<CPURuntimeConfig>(snippet->update_runtime_config());
-        const auto code_gen_result = cache->getOrCreate(
+        const auto& kernel_cache = context->getSnippetsKernelCache() ? context->getSnippetsKernelCache() : cache;
+        const auto code_gen_result = kernel_cache->getOrCreate(
             SubgraphCodeGeneratorKey(subgraph_attrs, getBroadcastingMask(in_shapes), key.constant_repacked_mask),
             [this, &snippet_config](const SubgraphCodeGeneratorKey& key) -> std::shared_ptr<SubgraphCodeGenerator> {
                 return std::make_shared<SubgraphCodeGenerator>(key.attrs, snippet_config, external_ptrs_idces);
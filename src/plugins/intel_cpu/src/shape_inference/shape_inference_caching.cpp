@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_inference/shape_inference_caching.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/primitive_hashing_utils.hpp"
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "openvino/core/coordinate_diff.hpp"
+#include "openvino/core/except.hpp"
+#include "shape_inference/shape_inference_status.hpp"
+#include "shape_inference_cpu.hpp"
+
+namespace ov::intel_cpu {
+
+size_t CachingShapeInfer::Key::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& dim : dims) {
+        seed = get_vector_hash(seed, dim);
+    }
+    seed = get_vector_hash(seed, valueSizes);
+    seed = get_vector_hash(seed, values);
+    return seed;
+}
+
+bool CachingShapeInfer::Key::operator==(const Key& rhs) const {
+    return dims == rhs.dims && valueSizes == rhs.valueSizes && values == rhs.values;
+}
+
+CachingShapeInfer::CachingShapeInfer(ShapeInferPtr shapeInfer, size_t capacity)
+    : m_shapeInfer(std::move(shapeInfer)),
+      m_cache(capacity) {
+    OPENVINO_ASSERT(m_shapeInfer, "CachingShapeInfer: wrapped shape inference is null");
+}
+
+IShapeInfer::Result CachingShapeInfer::infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                                             const std::unordered_map<size_t, MemoryPtr>& data_dependency) {
+    const auto port_mask = m_shapeInfer->get_port_mask();
+    size_t valuesSize = 0;
+    for (const auto& [port, mem] : data_dependency) {
+        if (port < input_shapes.size() && (port_mask & (1 << port)) != 0 && mem) {
+            valuesSize += mem->getSize();
+        }
+    }
+    if (valuesSize > maxKeyValuesSize) {
+        m_lastEntry = nullptr;
+        return m_shapeInfer->infer(input_shapes, data_dependency);
+    }
+
+    Key key;
+    key.dims.reserve(input_shapes.size());
+    for (const auto& shape : input_shapes) {
+        key.dims.push_back(shape.get());
+    }
+    key.values.reserve(valuesSize);
+    for (size_t port = 0; port < input_shapes.size(); ++port) {
+        if ((port_mask & (1 << port)) == 0) {
+            continue;
+        }
+        auto it = data_dependency.find(port);
+        if (it == data_dependency.end() || !it->second) {
+            key.valueSizes.push_back(0);
+            continue;
+        }
+        const auto* data = it->second->getDataAs<const uint8_t>();
+        key.valueSizes.push_back(it->second->getSize());
+        key.values.insert(key.values.end(), data, data + it->second->getSize());
+    }
+
+    if (auto entry = m_cache.get(key)) {
+        m_lastEntry = std::move(entry);
+        return {m_lastEntry->dims, ShapeInferStatus::success};
+    }
+
+    m_lastEntry = nullptr;
+    auto result = m_shapeInfer->infer(input_shapes, data_dependency);
+    if (ShapeInferStatus::success == result.status) {
+        auto entry = std::make_shared<Entry>();
+        entry->dims = result.dims;
+        entry->padsBegin = m_shapeInfer->get_pads_begin();
+        entry->padsEnd = m_shapeInfer->get_pads_end();
+        m_cache.put(key, entry);
+        m_lastEntry = std::move(entry);
+    }
+    return result;
+}
+
+const ov::CoordinateDiff& CachingShapeInfer::get_pads_begin() {
+    return m_lastEntry ? m_lastEntry->padsBegin : m_shapeInfer->get_pads_begin();
+}
+
+const ov::CoordinateDiff& CachingShapeInfer::get_pads_end() {
+    return m_lastEntry ? m_lastEntry->padsEnd : m_shapeInfer->get_pads_end();
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "cache/lru_cache.h"
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "openvino/core/coordinate_diff.hpp"
+#include "shape_inference_cpu.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Shape inference decorator, which memorizes the results of the wrapped shape inference for the most recently used
+ * input shapes (and input values for the data dependent ports). Since dynamic models usually see the same few shape
+ * signatures over and over again, a repeated signature is resolved without running the actual shape inference.
+ * The results with the skip status (internal dynamism) are never cached.
+ * Only the small data dependent inputs (shape like tensors) take part in the key, the signatures with the larger ones
+ * are passed to the wrapped shape inference directly, so the key never holds a copy of the actual data.
+ *
+ */
+class CachingShapeInfer final : public IShapeInfer {
+public:
+    // the limit of the total size of the data dependent inputs, which are keyed by value
+    static constexpr size_t maxKeyValuesSize = 256;
+
+    CachingShapeInfer(ShapeInferPtr shapeInfer, size_t capacity);
+
+    Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                 const std::unordered_map<size_t, MemoryPtr>& data_dependency) override;
+
+    const ov::CoordinateDiff& get_pads_begin() override;
+    const ov::CoordinateDiff& get_pads_end() override;
+
+    [[nodiscard]] port_mask_t get_port_mask() const override {
+        return m_shapeInfer->get_port_mask();
+    }
+
+    [[nodiscard]] const ShapeInferPtr& getWrapped() const {
+        return m_shapeInfer;
+    }
+
+private:
+    struct Key {
+        std::vector<VectorDims> dims;
+        // the sizes of the data dependent inputs and their bytes laid out one after another
+        std::vector<size_t> valueSizes;
+        std::vector<uint8_t> values;
+
+        [[nodiscard]] size_t hash() const;
+        bool operator==(const Key& rhs) const;
+    };
+
+    struct Entry {
+        std::vector<VectorDims> dims;
+        ov::CoordinateDiff padsBegin;
+        ov::CoordinateDiff padsEnd;
+    };
+
+    ShapeInferPtr m_shapeInfer;
+    LruCache<Key, std::shared_ptr<const Entry>> m_cache;
+    // the entry the last infer() call has been resolved with, null if the wrapped shape inference was called directly
+    std::shared_ptr<const Entry> m_lastEntry;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,220 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "brgemm_blocking_tuner.hpp"
+
+#include <oneapi/dnnl/dnnl_common_types.h>
+
+#include <algorithm>
+#include <chrono>
+#include <common/primitive_attr.hpp>
+#include <cpu/x64/brgemm/brgemm_types.hpp>
+#include <cstddef>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "emitters/snippets/x64/kernel_executors/brgemm_base.hpp"
+#include "onednn/dnnl.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu::pass {
+
+namespace {
+
+const std::vector<size_t> m_block_candidates{16, 32, 64, 128, 256};
+const std::vector<size_t> k_block_candidates{128, 256, 512, 1024};
+constexpr size_t benchmark_runs = 3;
+// The M blocks are computed independently, so a few of them are representative of the whole M dimension
+constexpr size_t max_benchmark_m = 1024;
+
+class BenchmarkExecutor : public x64::BrgemmBaseKernelExecutor {
+public:
+    using BrgemmBaseKernelExecutor::create_brgemm_kernel;
+    using BrgemmBaseKernelExecutor::execute_brgemm_kernel;
+};
+
+}  // namespace
+
+BrgemmBlockingTuner::BrgemmBlockingTuner(std::string db_path, Measure measure)
+    : m_db_path(std::move(db_path)),
+      m_measure(std::move(measure)),
+      m_l2_cache_size(dnnl::utils::get_cache_size(2, true)) {
+    load();
+}
+
+std::shared_ptr<BrgemmBlockingTuner> BrgemmBlockingTuner::get(const std::string& db_path) {
+    static std::mutex mutex;
+    static std::map<std::string, std::shared_ptr<BrgemmBlockingTuner>> tuners;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& tuner = tuners[db_path];
+    if (!tuner) {
+        tuner = std::make_shared<BrgemmBlockingTuner>(db_path);
+    }
+    return tuner;
+}
+
+BrgemmBlockingTuner::Blocking BrgemmBlockingTuner::get_blocking(const Shape& shape, const Blocking& heuristic) {
+    const auto key = make_key(shape);
+    const auto [heuristic_m_blk, n_blk, heuristic_k_blk] = heuristic;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (const auto it = m_blockings.find(key); it != m_blockings.end()) {
+        return Blocking{std::get<0>(it->second), n_blk, std::get<2>(it->second)};
+    }
+
+    std::set<size_t> m_blocks{heuristic_m_blk};
+    for (const auto blk : m_block_candidates) {
+        m_blocks.insert(std::min(blk, shape.m));
+    }
+    std::set<size_t> k_blocks{heuristic_k_blk};
+    for (const auto blk : k_block_candidates) {
+        k_blocks.insert(std::min(blk, shape.k));
+    }
+
+    Blocking best = heuristic;
+    double best_time = std::numeric_limits<double>::max();
+    for (const auto m_blk : m_blocks) {
+        for (const auto k_blk : k_blocks) {
+            const Blocking candidate{m_blk, n_blk, k_blk};
+            const auto time = m_measure(shape, candidate);
+            if (time < best_time) {
+                best_time = time;
+                best = candidate;
+            }
+        }
+    }
+    m_blockings.emplace(key, best);
+    store(key, best);
+    return best;
+}
+
+double BrgemmBlockingTuner::benchmark(const Shape& shape, const Blocking& blocking) {
+    OPENVINO_ASSERT(shape.precision == ov::element::f32,
+                    "Brgemm blocking benchmark supports only f32 precision, got ",
+                    shape.precision);
+    const auto m_blk = std::get<0>(blocking);
+    const auto n_blk = std::get<1>(blocking);
+    const auto k_blk = std::get<2>(blocking);
+    const auto M = std::min(shape.m, max_benchmark_m);
+    const auto N = shape.n;
+    const auto K = shape.k;
+    const auto LDB = shape.wei_n_blk != 0 ? shape.wei_n_blk : N;
+    const auto n_panels = shape.wei_n_blk != 0 ? div_up(N, shape.wei_n_blk) : 1;
+
+    std::vector<float> a(M * K, 1.F);
+    std::vector<float> b(n_panels * K * LDB, 1.F);
+    std::vector<float> c(M * N, 0.F);
+
+    // the first K block overwrites the output and the next ones accumulate to it, the tails need own kernels too
+    using KernelKey = std::tuple<size_t, size_t, size_t, bool>;
+    std::map<KernelKey, std::shared_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t>> kernels;
+    dnnl_post_ops post_ops;
+    auto get_kernel = [&](size_t m, size_t n, size_t k, bool first) {
+        auto& kernel = kernels[KernelKey{m, n, k, first}];
+        if (!kernel) {
+            BenchmarkExecutor::create_brgemm_kernel(kernel,
+                                                    dnnl_f32,
+                                                    dnnl_f32,
+                                                    dnnl_f32,
+                                                    shape.isa,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    K,
+                                                    LDB,
+                                                    N,
+                                                    first ? 0.F : 1.F,
+                                                    post_ops);
+        }
+        return kernel;
+    };
+    // the loop order matches the blocking loops: M is the outermost one and K is the innermost one
+    auto run = [&]() {
+        for (size_t m0 = 0; m0 < M; m0 += m_blk) {
+            const auto m = std::min(m_blk, M - m0);
+            for (size_t n0 = 0; n0 < N; n0 += n_blk) {
+                const auto n = std::min(n_blk, N - n0);
+                for (size_t k0 = 0; k0 < K; k0 += k_blk) {
+                    const auto k = std::min(k_blk, K - k0);
+                    const auto* b_ptr = shape.wei_n_blk != 0
+                                            ? b.data() + (n0 / shape.wei_n_blk) * K * LDB + k0 * LDB
+                                            : b.data() + k0 * LDB + n0;
+                    BenchmarkExecutor::execute_brgemm_kernel(get_kernel(m, n, k, k0 == 0),
+                                                             a.data() + m0 * K + k0,
+                                                             b_ptr,
+                                                             c.data() + m0 * N + n0,
+                                                             nullptr,
+                                                             nullptr,
+                                                             false,
+                                                             false);
+                }
+            }
+        }
+    };
+
+    // the warm up run compiles the kernels
+    run();
+    double best = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < benchmark_runs; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+        best = std::min(best, duration.count());
+    }
+    return best;
+}
+
+BrgemmBlockingTuner::Key BrgemmBlockingTuner::make_key(const Shape& shape) const {
+    return Key{static_cast<unsigned>(shape.isa),
+               m_l2_cache_size,
+               shape.precision.to_string(),
+               shape.m,
+               shape.n,
+               shape.k,
+               shape.wei_n_blk};
+}
+
+void BrgemmBlockingTuner::load() {
+    std::ifstream file(m_db_path);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream record(line);
+        unsigned isa = 0;
+        unsigned l2_cache_size = 0;
+        std::string precision;
+        size_t m = 0;
+        size_t n = 0;
+        size_t k = 0;
+        size_t wei_n_blk = 0;
+        size_t m_blk = 0;
+        size_t n_blk = 0;
+        size_t k_blk = 0;
+        // the malformed records, e.g. a record partially written by a killed process, are skipped
+        if (record >> isa >> l2_cache_size >> precision >> m >> n >> k >> wei_n_blk >> m_blk >> n_blk >> k_blk) {
+            m_blockings[Key{isa, l2_cache_size, precision, m, n, k, wei_n_blk}] = Blocking{m_blk, n_blk, k_blk};
+        }
+    }
+}
+
+void BrgemmBlockingTuner::store(const Key& key, const Blocking& blocking) const {
+    // the tuned blocking is still used by the current process if the database is read only
+    std::ofstream file(m_db_path, std::ios::app);
+    const auto& [isa, l2_cache_size, precision, m, n, k, wei_n_blk] = key;
+    const auto& [m_blk, n_blk, k_blk] = blocking;
+    file << isa << ' ' << l2_cache_size << ' ' << precision << ' ' << m << ' ' << n << ' ' << k << ' ' << wei_n_blk
+         << ' ' << m_blk << ' ' << n_blk << ' ' << k_blk << '\n';
+}
+
+}  // namespace ov::intel_cpu::pass
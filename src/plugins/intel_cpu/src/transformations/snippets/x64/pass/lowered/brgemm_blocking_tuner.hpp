@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu::pass {
+
+/**
+ * @interface BrgemmBlockingTuner
+ * @brief Selects Brgemm block sizes empirically: the candidate blockings of a brgemm shape are benchmarked and the
+ *        fastest one is stored in the tuning database file, so the next compilations on the same CPU read it from
+ *        there instead of benchmarking again.
+ *        The database is a text file with one record per line:
+ *        <isa> <L2 cache size> <precision> <M> <N> <K> <weights N block> <M block> <N block> <K block>
+ *        where the weights N block is zero for the planar weights. The stored N block is the heuristic one.
+ * @ingroup snippets
+ */
+class BrgemmBlockingTuner {
+public:
+    struct Shape {
+        dnnl::impl::cpu::x64::cpu_isa_t isa = dnnl::impl::cpu::x64::isa_undef;
+        ov::element::Type precision;
+        size_t m = 0;
+        size_t n = 0;
+        size_t k = 0;
+        // LDB of the blocked weights, zero if the weights are planar
+        size_t wei_n_blk = 0;
+    };
+    // (m_block, n_block, k_block), the blocks are not greater than the corresponding dimensions
+    using Blocking = std::tuple<size_t, size_t, size_t>;
+    // Returns the execution time of the brgemm shape computed with the given blocking in arbitrary units
+    using Measure = std::function<double(const Shape&, const Blocking&)>;
+
+    explicit BrgemmBlockingTuner(std::string db_path, Measure measure = benchmark);
+
+    /**
+     * @brief Returns the tuner of the database file shared by all the compilations of the process
+     */
+    static std::shared_ptr<BrgemmBlockingTuner> get(const std::string& db_path);
+
+    /**
+     * @brief Returns the blocking stored in the database or tunes it if the shape has not been tuned yet.
+     *        Only M and K blocks are tuned, the returned N block is always the heuristic one as it defines the layout
+     *        of the repacked weights.
+     * @param shape static brgemm shape
+     * @param heuristic blocking selected by the heuristic, it is always one of the candidates
+     */
+    Blocking get_blocking(const Shape& shape, const Blocking& heuristic);
+
+    /**
+     * @brief Measures the blocking by executing the brgemm kernels on the shape on the current thread
+     */
+    static double benchmark(const Shape& shape, const Blocking& blocking);
+
+private:
+    using Key = std::tuple<unsigned, unsigned, std::string, size_t, size_t, size_t, size_t>;
+
+    Key make_key(const Shape& shape) const;
+    void load();
+    void store(const Key& key, const Blocking& blocking) const;
+
+    const std::string m_db_path;
+    const Measure m_measure;
+    const unsigned m_l2_cache_size;
+    // the shapes are tuned one by one, so the benchmarks of the concurrent compilations do not disturb each other
+    std::mutex m_mutex;
+    std::map<Key, Blocking> m_blockings;
+};
+
+}  // namespace ov::intel_cpu::pass
@@ -4,6 +4,7 @@
 
 #include "brgemm_cpu_blocking.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <iterator>
@@ -129,6 +130,22 @@ std::tuple<size_t, size_t, size_t> BrgemmCPUBlocking::get_blocking_params(
     if (is_kn_blocking_supported(brgemm->get_input_element_type(1))) {
         OPENVINO_ASSERT(brgemm->get_postops_config().post_ops.len() == 0,
                         "Blocking for Brgemm with postops is not supported");
+        if (m_tuner && !is_dynamic_value(m) && !is_dynamic_value(n) && !is_dynamic_value(k)) {
+            const auto blocked_wei = brgemm_config.with_wei_repacking() && brgemm_config.are_wei_blocked();
+            const BrgemmBlockingTuner::Shape shape{brgemm_config.isa(),
+                                                   brgemm->get_input_element_type(1),
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   blocked_wei ? brgemm_config.wei_n_blk() : 0};
+            // the full dimension blocks are passed to the tuner as the dimensions
+            const auto [tuned_m_blk, tuned_n_blk, tuned_k_blk] = m_tuner->get_blocking(
+                shape,
+                BrgemmBlockingTuner::Blocking{std::min(m_blk, m), std::min(n_blk, n), std::min(k_blk, k)});
+            m_blk = get_corrected_blk_size_by_dim(m, tuned_m_blk);
+            n_blk = get_corrected_blk_size_by_dim(n, tuned_n_blk);
+            k_blk = get_corrected_blk_size_by_dim(k, tuned_k_blk);
+        }
     } else {
         OPENVINO_ASSERT(!brgemm_config.are_wei_blocked(),
                         "Weights of Brgemm cannot be repacked in blocked format if KN blocking is not supported");
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <memory>
 #include <tuple>
+#include <utility>
 
 #include "openvino/core/rtti.hpp"
 #include "snippets/lowered/expression.hpp"
@@ -15,6 +16,7 @@
 #include "snippets/lowered/pass/pass.hpp"
 #include "snippets/lowered/specific_loop_iter_handlers.hpp"
 #include "transformations/snippets/x64/op/brgemm_cpu.hpp"
+#include "transformations/snippets/x64/pass/lowered/brgemm_blocking_tuner.hpp"
 
 namespace ov::intel_cpu::pass {
 
@@ -27,6 +29,11 @@ class BrgemmCPUBlocking : public ov::snippets::lowered::pass::BrgemmBlocking<Brg
 public:
     OPENVINO_RTTI("BrgemmCPUBlocking", "", BrgemmBlocking)
 
+    /**
+     * @param tuner selects the blocking of the static f32 Brgemms empirically, the heuristic is used if it is nullptr
+     */
+    explicit BrgemmCPUBlocking(std::shared_ptr<BrgemmBlockingTuner> tuner = nullptr) : m_tuner(std::move(tuner)) {}
+
     /**
      * @interface DummyPass
      * @brief The empty pass which is used to force insertion of first specific iteration of loop by K dimension
@@ -85,6 +92,8 @@ private:
                              size_t m_block,
                              size_t n_block,
                              size_t k_block) override;
+
+    std::shared_ptr<BrgemmBlockingTuner> m_tuner;
 };
 
 }  // namespace ov::intel_cpu::pass
@@ -10,7 +10,9 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <vector>
 
@@ -38,6 +40,7 @@
 #include "openvino/op/clamp.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/embedding_segments_sum.hpp"
 #include "openvino/op/fake_quantize.hpp"
 #include "openvino/op/grouped_matmul.hpp"
 #include "openvino/op/matmul.hpp"
@@ -49,6 +52,8 @@
 #include "openvino/op/result.hpp"
 #include "openvino/op/transpose.hpp"
 #include "openvino/op/util/attr_types.hpp"
+#include "openvino/op/util/embeddingbag_offsets_base.hpp"
+#include "openvino/op/util/embeddingbag_packed_base.hpp"
 #include "ov_ops/gather_compressed.hpp"
 #include "ov_ops/gather_matmul.hpp"
 
@@ -161,6 +166,7 @@
 #include "snippets/pass/gated_mlp_tokenization.hpp"
 #include "snippets/pass/mha_tokenization.hpp"
 #include "snippets/pass/mlp_seq_tokenization.hpp"
+#include "snippets/pass/mvn_tokenization.hpp"
 #include "snippets/pass/tokenization.hpp"
 #include "snippets/pass/tokenization_config.hpp"
 #include "snippets/utils/tokenization_utils.hpp"
@@ -311,11 +317,22 @@ bool Transformations::is_decompression_multiply(const_node_ptr& node) {
         });
     };
 
-    auto benefit_from_decompression = [&all_has_type](const std::set<ov::Input<ov::Node>>& consumers) {
+    // The embedding nodes decompress only the gathered rows of the table
+    auto all_are_embedding_tables = [](const std::set<ov::Input<ov::Node>>& consumers) {
+        return std::all_of(consumers.begin(), consumers.end(), [](const ov::Input<ov::Node>& input) {
+            return input.get_index() == 0 && is_type_any_of<ov::op::util::EmbeddingBagOffsetsBase,
+                                                            ov::op::util::EmbeddingBagPackedBase,
+                                                            ov::op::v3::EmbeddingSegmentsSum>(input.get_node());
+        });
+    };
+
+    auto benefit_from_decompression = [&all_has_type,
+                                       &all_are_embedding_tables](const std::set<ov::Input<ov::Node>>& consumers) {
         return all_has_type(consumers, ov::op::v0::MatMul::get_type_info_static()) ||
                all_has_type(consumers, ov::op::v1::Convolution::get_type_info_static()) ||
                all_has_type(consumers, ov::op::v17::GroupedMatMul::get_type_info_static()) ||
-               all_has_type(consumers, ov::op::internal::GatherMatmul::get_type_info_static());
+               all_has_type(consumers, ov::op::internal::GatherMatmul::get_type_info_static()) ||
+               all_are_embedding_tables(consumers);
     };
 
     const auto consumers = node->get_output_target_inputs(0);
@@ -588,7 +605,11 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
                                        ov::op::v1::GroupConvolution,
                                        ov::op::v1::ConvolutionBackpropData,
                                        ov::op::v1::GroupConvolutionBackpropData,
-                                       ov::op::v17::GroupedMatMul>(consumer.get_node());
+                                       ov::op::v17::GroupedMatMul>(consumer.get_node()) &&
+                       !(consumer.get_index() == 0 && is_type_any_of<ov::op::util::EmbeddingBagOffsetsBase,
+                                                                     ov::op::util::EmbeddingBagPackedBase,
+                                                                     ov::op::v3::EmbeddingSegmentsSum>(
+                                                          consumer.get_node()));
             });
         },
         ov::pass::KeepConstAndDecompression);
@@ -1377,6 +1398,17 @@ void Transformations::MainSnippets() {
         CPU_DISABLE_PASS_COMMON(snippetsManager, TokenizeMLPSeqSnippets);
     }
 
+#if defined(OPENVINO_ARCH_X86_64)
+    // The fused residual Add, MVN and post-ops are computed in f32
+    const bool isMVNSupported = any_of(config.inferencePrecision, ov::element::f32, ov::element::dynamic);
+#else
+    const bool isMVNSupported = false;
+#endif
+
+    if (!isMVNSupported) {
+        CPU_DISABLE_PASS_COMMON(snippetsManager, TokenizeMVNSnippets);
+    }
+
 #if defined(OPENVINO_ARCH_X86_64)
     auto is_supported_matmul = [this](const std::shared_ptr<const ov::Node>& n) {
         const auto matmul = ov::as_type_ptr<const ov::op::v0::MatMul>(n);
@@ -1562,6 +1594,20 @@ void Transformations::MainSnippets() {
                        is_unsupported_parallel_work_amount(n, n->get_output_partial_shape(0));
             },
             ExtractReshapesFromMHA);
+        CPU_SET_CALLBACK_X64(
+            snippetsManager,
+            [&](const std::shared_ptr<const ov::Node>& n) -> bool {
+                // The reductions reread the normalized row, so it must fit L1 cache to be memory efficient.
+                // The Subgraph is parallelized only by the outer dimensions, they must load all the threads.
+                const auto& shape = n->get_input_shape(0);
+                const auto row_size = shape.back() * n->get_input_element_type(0).size();
+                if (row_size > dnnl::utils::get_cache_size(1, true))
+                    return true;
+                const auto parallel_work_amount =
+                    std::accumulate(shape.begin(), shape.end() - 1, size_t{1}, std::multiplies<>());
+                return parallel_work_amount < common_optimizations_config.get_concurrency();
+            },
+            TokenizeMVNSnippets);
     }
 
     CPU_SET_CALLBACK_COMMON(
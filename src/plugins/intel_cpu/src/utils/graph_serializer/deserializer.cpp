@@ -4,6 +4,7 @@
 
 #include "deserializer.hpp"
 
+#include <cctype>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -11,12 +12,15 @@
 #include <functional>
 #include <istream>
 #include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
 
+#include "dnnl_extension_utils.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/extension.hpp"
@@ -40,9 +44,48 @@
 #include "openvino/util/xml_parse_utils.hpp"
 #include "openvino/xml_util/xml_deserialize_util.hpp"
 #include "utils/codec_xor.hpp"
+#include "utils/rt_info/packed_weights_attribute.hpp"
+#include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
 
+namespace {
+
+std::vector<uint8_t> from_hex(const std::string& hex) {
+    OPENVINO_ASSERT(hex.size() % 2 == 0, "[CPU] Could not deserialize the packed weights.");
+    auto digit = [](char c) -> uint8_t {
+        OPENVINO_ASSERT(std::isxdigit(static_cast<unsigned char>(c)), "[CPU] Could not deserialize the packed weights.");
+        return static_cast<uint8_t>(std::isdigit(static_cast<unsigned char>(c)) ? c - '0' : std::tolower(c) - 'a' + 10);
+    };
+    std::vector<uint8_t> result(hex.size() / 2);
+    for (size_t i = 0; i < result.size(); i++) {
+        result[i] = static_cast<uint8_t>((digit(hex[2 * i]) << 4) | digit(hex[2 * i + 1]));
+    }
+    return result;
+}
+
+// the alignment of the memory allocated for the weights by the plugin
+constexpr size_t packed_weights_alignment = 64;
+
+// The custom data xml may be followed by the packed weights, the xml ends with the null character then
+size_t get_custom_xml_size(const char* data, size_t size) {
+    const auto* end = static_cast<const char*>(std::memchr(data, '\0', size));
+    return end != nullptr ? static_cast<size_t>(end - data) : size;
+}
+
+// Returns the offset of the packed weights from the beginning of the custom data, 0 if there are no packed weights
+uint64_t get_packed_weights_offset(const char* data, size_t size, size_t xml_size) {
+    if (xml_size + 1 + sizeof(uint64_t) > size) {
+        return 0;
+    }
+    uint64_t offset = 0;
+    std::memcpy(&offset, data + xml_size + 1, sizeof(offset));
+    OPENVINO_ASSERT(offset <= size, "[CPU] Could not deserialize the packed weights.");
+    return offset;
+}
+
+}  // namespace
+
 ModelDeserializer::ModelDeserializer(std::shared_ptr<ov::AlignedBuffer>& model_buffer,
                                      const std::shared_ptr<ov::ICore>& core,
                                      const CacheDecrypt& decrypt_fn,
@@ -87,6 +130,29 @@ ModelDeserializer::ModelDeserializer(std::istream& model_stream,
 
 void ModelDeserializer::set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model) {}
 
+void ModelDeserializer::read_packed_weights(const pugi::xml_node& root,
+                                            const std::shared_ptr<ov::AlignedBuffer>& weights) {
+    const auto packed_node = root.child("cnndata").child("packed_weights");
+    if (!packed_node) {
+        return;
+    }
+    // the source weights are not stored, so the model can not be compiled without the packed weights
+    OPENVINO_ASSERT(ov::util::pugixml::get_int_attr(packed_node, "isa") ==
+                        static_cast<int>(dnnl::get_effective_cpu_isa()),
+                    "[CPU] The compiled blob contains the weights packed for a different instruction set.");
+    auto packed_weights = std::make_shared<ImportedPackedWeights>(weights);
+    for (const auto& node : packed_node.children("weights")) {
+        const auto desc = from_hex(ov::util::pugixml::get_str_attr(node, "desc"));
+        packed_weights->add(ov::util::pugixml::get_uint64_attr(node, "id"),
+                            static_cast<size_t>(ov::util::pugixml::get_uint64_attr(node, "offset")),
+                            static_cast<size_t>(ov::util::pugixml::get_uint64_attr(node, "size")),
+                            DnnlExtensionUtils::makeDescriptor(dnnl::memory::desc(desc)));
+    }
+    if (!packed_weights->empty()) {
+        m_packed_weights = std::move(packed_weights);
+    }
+}
+
 void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
     std::visit(
         [&](auto&& arg) {
@@ -99,11 +165,11 @@ std::shared_ptr<ov::Model> ModelDeserializer::create_ov_model(
     const std::shared_ptr<ov::AlignedBuffer>& model_buf,
     const std::shared_ptr<ov::AlignedBuffer>& weights,
     const std::shared_ptr<ov::AlignedBuffer>& origin_weights) {
-    if (origin_weights == nullptr) {
+    if (origin_weights == nullptr && m_packed_weights == nullptr) {
         return m_core->read_model(model_buf, weights);
     }
 
-    // Custom deserialization for weightless mode
+    // Custom deserialization for weightless mode and for the constants restored from the packed weights
 
     pugi::xml_document xml_doc;
     const auto root = [&] {
@@ -135,7 +201,14 @@ std::shared_ptr<ov::Model> ModelDeserializer::create_ov_model(
 
     std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> variables;
     const auto& w = (weights != nullptr && weights->size() != 0) ? weights : origin_weights;
-    XmlDeserializer visitor(root, w, origin_weights, opsets, create_extensions_map, variables, version);
+    XmlDeserializer visitor(root,
+                            w,
+                            origin_weights,
+                            m_packed_weights,
+                            opsets,
+                            create_extensions_map,
+                            variables,
+                            version);
     std::shared_ptr<ov::Model> model;
     visitor.on_attribute("net", model);
     model->get_rt_info()["version"] = static_cast<int64_t>(version);
@@ -164,11 +237,26 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     // Read model input/output precisions.
     pugi::xml_document xml_in_out_doc;
     if (hdr.custom_data_size > 0LU) {
-        auto res = xml_in_out_doc.load_buffer(buffer_base + hdr.custom_data_offset,
-                                              hdr.custom_data_size,
-                                              pugi::parse_default,
-                                              pugi::encoding_utf8);
+        const auto* custom_data = buffer_base + hdr.custom_data_offset;
+        const auto xml_size = get_custom_xml_size(custom_data, hdr.custom_data_size);
+        auto res = xml_in_out_doc.load_buffer(custom_data, xml_size, pugi::parse_default, pugi::encoding_utf8);
         OPENVINO_ASSERT(res.status == pugi::status_ok, "[CPU] Could to deserialize custom data.");
+
+        if (const auto offset = get_packed_weights_offset(custom_data, hdr.custom_data_size, xml_size)) {
+            // the mapped weights are used in place if the blob is aligned, the weights are copied otherwise
+            auto* packed_data = const_cast<char*>(custom_data) + offset;
+            const auto packed_size = hdr.custom_data_size - offset;
+            std::shared_ptr<ov::AlignedBuffer> packed_buf;
+            if (reinterpret_cast<uintptr_t>(packed_data) % packed_weights_alignment == 0) {
+                packed_buf = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(packed_data,
+                                                                                                    packed_size,
+                                                                                                    model_buffer);
+            } else {
+                packed_buf = std::make_shared<ov::AlignedBuffer>(packed_size, packed_weights_alignment);
+                std::memcpy(packed_buf->get_ptr(), packed_data, packed_size);
+            }
+            read_packed_weights(xml_in_out_doc, packed_buf);
+        }
     }
 
     // Map blob content
@@ -234,6 +322,14 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
         auto res = xmlInOutDoc.load_string(xmlInOutString.c_str());
         OPENVINO_ASSERT(res.status == pugi::status_ok,
                         "NetworkNotRead: The inputs and outputs information is invalid.");
+
+        const auto xml_size = get_custom_xml_size(xmlInOutString.data(), xmlInOutString.size());
+        if (const auto offset = get_packed_weights_offset(xmlInOutString.data(), xmlInOutString.size(), xml_size)) {
+            const auto packed_size = hdr.custom_data_size - offset;
+            auto packed_buf = std::make_shared<ov::AlignedBuffer>(packed_size, packed_weights_alignment);
+            std::memcpy(packed_buf->get_ptr(), xmlInOutString.data() + offset, packed_size);
+            read_packed_weights(xmlInOutDoc, packed_buf);
+        }
     }
 
     // read blob content
@@ -292,10 +388,33 @@ ov::Any XmlDeserializer::parse_weightless_cache_attribute(const pugi::xml_node&
     return {};
 }
 
+std::optional<uint64_t> XmlDeserializer::parse_packed_weights_id(const pugi::xml_node& node) {
+    if (auto rt_info = node.child("rt_info")) {
+        for (const auto& child : rt_info.children()) {
+            if (strcmp(child.attribute("name").value(), PackedWeightsAttribute::get_type_info_static().name) == 0) {
+                return ov::util::pugixml::get_uint64_attr(child, "id");
+            }
+        }
+    }
+    return std::nullopt;
+}
+
 void XmlDeserializer::set_constant_num_buffer(ov::AttributeAdapter<std::shared_ptr<ov::AlignedBuffer>>& adapter) {
+    const auto& node = get_node();
+    if (const auto id = m_packed_weights ? parse_packed_weights_id(node) : std::nullopt) {
+        const auto dn = node.child("data");
+        const element::Type dtype{ov::util::pugixml::get_str_attr(dn, "element_type")};
+        ov::Shape shape;
+        OPENVINO_ASSERT(getParameters<size_t>(dn, "shape", shape),
+                        "[ CPU ] Could not get attribute 'shape' during weights deserialization.");
+        auto buffer = m_packed_weights->getSource(*id, ov::util::get_memory_size(dtype, ov::shape_size(shape)));
+        OPENVINO_ASSERT(buffer, "[CPU] The packed weights of the constant are not found in the compiled blob.");
+        adapter.set(buffer);
+        return;
+    }
+
     OPENVINO_ASSERT(get_weights() != nullptr || m_origin_weights != nullptr,
                     "Empty weights data in bin file or bin file cannot be found!");
-    const auto& node = get_node();
     const auto dn = node.child("data");
     const element::Type target_dtype{ov::util::pugixml::get_str_attr(dn, "element_type")};
 
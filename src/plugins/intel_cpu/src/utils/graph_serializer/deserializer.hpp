@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <istream>
+#include <optional>
 #include <pugixml.hpp>
 #include <string>
 #include <variant>
@@ -14,6 +16,7 @@
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "utils/codec_xor.hpp"
+#include "weights_cache.hpp"
 
 namespace ov {
 class ICore;
@@ -31,12 +34,14 @@ public:
     explicit XmlDeserializer(const pugi::xml_node& node,
                              const std::shared_ptr<ov::AlignedBuffer>& weights,
                              const std::shared_ptr<ov::AlignedBuffer>& origin_weights,
+                             ImportedPackedWeights::Ptr packed_weights,
                              const std::unordered_map<std::string, ov::OpSet>& opsets,
                              const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                              std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables,
                              size_t version)
         : ov::util::XmlDeserializer(node, weights, opsets, extensions, variables, version),
-          m_origin_weights{origin_weights} {}
+          m_origin_weights{origin_weights},
+          m_packed_weights{std::move(packed_weights)} {}
 
     explicit XmlDeserializer(const pugi::xml_node& node,
                              const std::shared_ptr<ov::AlignedBuffer>& weights,
@@ -44,13 +49,16 @@ public:
                              const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                              std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables,
                              size_t version)
-        : XmlDeserializer(node, weights, nullptr, opsets, extensions, variables, version) {}
+        : XmlDeserializer(node, weights, nullptr, nullptr, opsets, extensions, variables, version) {}
 
 protected:
     ov::Any parse_weightless_cache_attribute(const pugi::xml_node& node) const override;
 
     void set_constant_num_buffer(ov::AttributeAdapter<std::shared_ptr<ov::AlignedBuffer>>& adapter) override;
 
+    // Returns the id of the stored packed weights the constant is restored from
+    static std::optional<uint64_t> parse_packed_weights_id(const pugi::xml_node& node);
+
 private:
     std::unique_ptr<ov::util::XmlDeserializer> make_visitor(
         const pugi::xml_node& node,
@@ -62,6 +70,7 @@ private:
         return std::make_unique<XmlDeserializer>(node,
                                                  weights,
                                                  m_origin_weights,
+                                                 m_packed_weights,
                                                  opsets,
                                                  extensions,
                                                  variables,
@@ -69,6 +78,7 @@ private:
     }
 
     std::shared_ptr<ov::AlignedBuffer> m_origin_weights;
+    ImportedPackedWeights::Ptr m_packed_weights;
 };
 
 class ModelDeserializer {
@@ -89,9 +99,18 @@ public:
 
     void operator>>(std::shared_ptr<ov::Model>& model);
 
+    /**
+     * Returns the weights in the final layout stored in the blob or nullptr if there are none
+     */
+    const ImportedPackedWeights::Ptr& get_packed_weights() const {
+        return m_packed_weights;
+    }
+
 protected:
     static void set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model);
 
+    void read_packed_weights(const pugi::xml_node& root, const std::shared_ptr<ov::AlignedBuffer>& weights);
+
     void process_model(std::shared_ptr<ov::Model>& model, const std::shared_ptr<ov::AlignedBuffer>& model_buffer);
 
     void process_model(std::shared_ptr<ov::Model>& model, std::reference_wrapper<std::istream> model_stream);
@@ -105,6 +124,7 @@ protected:
     CacheDecrypt m_cache_decrypt;
     bool m_decript_from_string;
     std::shared_ptr<ov::AlignedBuffer> m_origin_weights_buf;
+    ImportedPackedWeights::Ptr m_packed_weights;
 };
 
 }  //  namespace ov::intel_cpu
@@ -9,21 +9,60 @@
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
 #include <ostream>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "memory_desc/cpu_memory_desc_utils.h"
+#include "memory_desc/dnnl_memory_desc.h"
+#include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/core/runtime_attribute.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/group_conv.hpp"
+#include "openvino/op/matmul.hpp"
 #include "openvino/pass/serialize.hpp"
+#include "openvino/util/memory.hpp"
 #include "openvino/xml_util/constant_writer.hpp"
 #include "openvino/xml_util/xml_serialize_util.hpp"
+#include "ov_ops/fully_connected.hpp"
+#include "utils/rt_info/packed_weights_attribute.hpp"
+#include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
 
+namespace {
+
+std::string to_hex(const std::vector<uint8_t>& data) {
+    static constexpr char digits[] = "0123456789abcdef";
+    std::string result;
+    result.reserve(data.size() * 2);
+    for (const auto byte : data) {
+        result.push_back(digits[byte >> 4]);
+        result.push_back(digits[byte & 0xF]);
+    }
+    return result;
+}
+
+// The weights input of the nodes whose executors read the constant weights only through
+// utils::prepareWeightsMemory(), which finds the imported packed weights by the constant data
+bool reads_weights_through_cache(const ov::Input<ov::Node>& input) {
+    const auto* node = input.get_node();
+    return input.get_index() == 1 &&
+           (ov::is_type<ov::op::internal::FullyConnected>(node) || ov::is_type<ov::op::v1::Convolution>(node) ||
+            ov::is_type<ov::op::v1::GroupConvolution>(node) || ov::is_type<ov::op::v0::MatMul>(node));
+}
+
+}  // namespace
+
 class WeightlessWriter : public util::ConstantWriter {
 public:
     explicit WeightlessWriter(util::ConstantWriter& other) : util::ConstantWriter(other), m_offset{} {}
@@ -94,6 +133,13 @@ private:
             node.append_attribute("bin_offset").set_value(wl_attr->bin_offset);
             node.append_attribute("original_size").set_value(wl_attr->original_size);
 
+            result = true;
+        } else if (const auto* packed_attr = ov::as_type<const PackedWeightsAttribute>(&attribute)) {
+            const auto& type_info = attribute.get_type_info();
+            node.append_attribute("name").set_value(type_info.name);
+            node.append_attribute("version").set_value(type_info.get_version().data());
+            node.append_attribute("id").set_value(static_cast<unsigned long long>(packed_attr->id));
+
             result = true;
         } else {
             result = util::XmlSerializer::append_rt_attribute(node, attribute);
@@ -103,8 +149,11 @@ private:
     }
 
     bool append_node_attributes(ov::Node& node) override {
+        const auto& rt_info = node.get_rt_info();
+        // the constants covered by the stored packed weights are restored from them on import
         m_weightless_const_writer.skip_weights(
-            m_weightless_mode && node.get_rt_info().count(ov::WeightlessCacheAttribute::get_type_info_static()) != 0);
+            (m_weightless_mode && rt_info.count(ov::WeightlessCacheAttribute::get_type_info_static()) != 0) ||
+            rt_info.count(PackedWeightsAttribute::get_type_info_static()) != 0);
 
         auto result = util::XmlSerializer::append_node_attributes(node);
 
@@ -140,20 +189,130 @@ private:
 
 ////////// ModelSerializer //////////
 
-ModelSerializer::ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn, bool weightless_mode)
+ModelSerializer::ModelSerializer(std::ostream& ostream,
+                                 const CacheEncrypt& encrypt_fn,
+                                 bool weightless_mode,
+                                 PackedWeightsList packed_weights)
     : ov::pass::StreamSerialize(
           ostream,
-          [](std::ostream& stream) {
-              pugi::xml_document xml_doc;
-              pugi::xml_node root = xml_doc.append_child("cnndata");
-              root.append_child("outputs");
-              xml_doc.save(stream);
+          [this](std::ostream& stream) {
+              write_custom_data(stream);
           },
           encrypt_fn),
-      m_weightless_mode(weightless_mode) {};
+      m_weightless_mode(weightless_mode),
+      m_packed_weights(std::move(packed_weights)) {};
+
+void ModelSerializer::select_packed_weights(ov::Model& model) {
+    m_stored_weights.clear();
+    if (m_packed_weights.empty()) {
+        return;
+    }
+
+    std::unordered_multimap<const void*, const PackedWeights*> by_source;
+    for (const auto& weights : m_packed_weights) {
+        by_source.emplace(weights.source->getData(), &weights);
+    }
+
+    // The plain data is left out only if no consumer of any constant sharing it reads it as is (e.g. the Gather of
+    // the embeddings tied with the lm_head FullyConnected), as on import such constant refers to the packed weights
+    std::unordered_map<const void*, bool> packed_only;
+    for (const auto& node : model.get_ordered_ops()) {
+        auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node);
+        if (!constant) {
+            continue;
+        }
+        auto& only = packed_only.try_emplace(constant->get_data_ptr(), true).first->second;
+        for (const auto& input : constant->output(0).get_target_inputs()) {
+            only = only && reads_weights_through_cache(input);
+        }
+    }
+
+    std::unordered_map<const void*, uint64_t> ids;
+    for (const auto& node : model.get_ordered_ops()) {
+        auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node);
+        if (!constant) {
+            continue;
+        }
+        const auto* data = constant->get_data_ptr();
+        if (!packed_only.at(data)) {
+            continue;
+        }
+        // the constants sharing the data share the stored weights
+        if (auto id = ids.find(data); id != ids.end()) {
+            constant->get_rt_info()[PackedWeightsAttribute::get_type_info_static()] = PackedWeightsAttribute{id->second};
+            continue;
+        }
+        const auto id = static_cast<uint64_t>(ids.size());
+        auto [begin, end] = by_source.equal_range(data);
+        for (auto it = begin; it != end; ++it) {
+            const auto& weights = *it->second;
+            if (weights.source->getSize() != constant->get_byte_size() ||
+                weights.source->getDesc().getPrecision() != constant->get_element_type()) {
+                continue;
+            }
+            m_stored_weights.emplace_back(id, weights.packed);
+        }
+        if (m_stored_weights.empty() || m_stored_weights.back().first != id) {
+            continue;
+        }
+        ids.emplace(data, id);
+        constant->get_rt_info()[PackedWeightsAttribute::get_type_info_static()] = PackedWeightsAttribute{id};
+    }
+}
+
+void ModelSerializer::write_custom_data(std::ostream& stream) const {
+    pugi::xml_document xml_doc;
+    pugi::xml_node root = xml_doc.append_child("cnndata");
+    root.append_child("outputs");
+
+    const auto start = static_cast<int64_t>(stream.tellp());
+    // the packed weights are aligned to the absolute position in the stream, so they can be used in place once mapped
+    OPENVINO_ASSERT(m_stored_weights.empty() || start >= 0, "[CPU] Could not store the packed weights.");
+    if (m_stored_weights.empty()) {
+        xml_doc.save(stream);
+        return;
+    }
+
+    auto packed_node = root.append_child("packed_weights");
+    // the layouts depend on the instruction set, so the weights are not reordered back on a different machine
+    packed_node.append_attribute("isa").set_value(static_cast<int>(dnnl::get_effective_cpu_isa()));
+    uint64_t offset = 0;
+    for (const auto& [id, memory] : m_stored_weights) {
+        const auto desc = MemoryDescUtils::convertToDnnlMemoryDesc(memory->getDescPtr());
+        auto weights = packed_node.append_child("weights");
+        weights.append_attribute("id").set_value(static_cast<unsigned long long>(id));
+        weights.append_attribute("offset").set_value(static_cast<unsigned long long>(offset));
+        weights.append_attribute("size").set_value(static_cast<unsigned long long>(memory->getSize()));
+        weights.append_attribute("desc").set_value(to_hex(dnnl::memory::desc(desc->getDnnlDesc()).get_blob()).c_str());
+        offset = ov::util::align_size_up(offset + memory->getSize(), ov::util::min_page_alignment);
+    }
+    xml_doc.save(stream);
+
+    // the xml is followed by the offset of the packed weights from the beginning of the custom data
+    stream.put('\0');
+    const auto header_end = static_cast<uint64_t>(stream.tellp()) + sizeof(uint64_t);
+    const uint64_t weights_offset =
+        ov::util::align_size_up(header_end, ov::util::min_page_alignment) - static_cast<uint64_t>(start);
+    stream.write(reinterpret_cast<const char*>(&weights_offset), sizeof(weights_offset));
+
+    const std::vector<char> padding(ov::util::min_page_alignment, 0);
+    auto pad_to = [&](uint64_t position) {
+        const auto current = static_cast<uint64_t>(stream.tellp()) - static_cast<uint64_t>(start);
+        stream.write(padding.data(), static_cast<std::streamsize>(position - current));
+    };
+    offset = 0;
+    for (const auto& item : m_stored_weights) {
+        const auto& memory = item.second;
+        pad_to(weights_offset + offset);
+        stream.write(memory->getDataAs<const char>(), static_cast<std::streamsize>(memory->getSize()));
+        offset = ov::util::align_size_up(offset + memory->getSize(), ov::util::min_page_alignment);
+    }
+}
 
 void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
-    run_on_model(std::const_pointer_cast<ov::Model>(model->clone()));
+    auto cloned = model->clone();
+    select_packed_weights(*cloned);
+    run_on_model(cloned);
 }
 
 bool ModelSerializer::use_absolute_offset() {
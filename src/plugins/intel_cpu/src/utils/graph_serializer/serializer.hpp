@@ -4,12 +4,16 @@
 
 #pragma once
 
+#include <cstdint>
 #include <ostream>
 #include <pugixml.hpp>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "openvino/core/model.hpp"
 #include "openvino/pass/serialize.hpp"
+#include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
 
@@ -17,7 +21,10 @@ class ModelSerializer : private ov::pass::StreamSerialize {
 public:
     using CacheEncrypt = std::function<std::string(const std::string&)>;
 
-    explicit ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn = {}, bool weightless_mode = false);
+    explicit ModelSerializer(std::ostream& ostream,
+                             const CacheEncrypt& encrypt_fn = {},
+                             bool weightless_mode = false,
+                             PackedWeightsList packed_weights = {});
 
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
@@ -33,7 +40,16 @@ private:
                                                          ov::element::Type output_element_type,
                                                          bool data_is_temporary) const override;
 
+    // Marks the constants read through the packed weights, their data is replaced with the packed weights in the blob
+    void select_packed_weights(ov::Model& model);
+
+    void write_custom_data(std::ostream& stream) const;
+
     bool m_weightless_mode;
+    PackedWeightsList m_packed_weights;
+    // the weights in the final layout along with the id of their source constant, stored in the custom data after the
+    // xml
+    std::vector<std::pair<uint64_t, MemoryCPtr>> m_stored_weights;
 };
 
 }  // namespace ov::intel_cpu
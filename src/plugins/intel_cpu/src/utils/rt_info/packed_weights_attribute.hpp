@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "openvino/core/rtti.hpp"
+#include "openvino/core/runtime_attribute.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Marks the constant whose data is not stored in the compiled blob, as the weights reordered from it are stored instead
+ * The id is assigned on export and matches the constant with its stored weights on import
+ */
+class PackedWeightsAttribute : public ov::RuntimeAttribute {
+public:
+    OPENVINO_RTTI("PackedWeights", "0", RuntimeAttribute);
+
+    PackedWeightsAttribute() = default;
+    explicit PackedWeightsAttribute(uint64_t id) : id(id) {}
+
+    [[nodiscard]] bool is_copyable() const override {
+        return false;
+    }
+
+    uint64_t id = 0;
+};
+
+}  // namespace ov::intel_cpu
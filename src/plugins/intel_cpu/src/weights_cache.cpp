@@ -4,22 +4,67 @@
 
 #include "weights_cache.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
-#ifdef CPU_DEBUG_CAPS
-#    include <vector>
-#endif
+#include <vector>
 
 #include "cpu_memory.h"
+#include "memory_desc/dnnl_memory_desc.h"
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/system_conf.hpp"
 
 namespace ov::intel_cpu {
 
+void ImportedPackedWeights::add(uint64_t id, size_t offset, size_t size, DnnlMemoryDescPtr desc) {
+    OPENVINO_ASSERT(offset + size <= m_buffer->size() && desc->getCurrentMemSize() == size,
+                    "[CPU] Packed weights are out of the compiled blob");
+    auto& stored = m_weights[id];
+    if (stored.empty()) {
+        m_sources[m_buffer->get_ptr<char>() + offset] = id;
+    }
+    stored.push_back({offset, size, std::move(desc)});
+}
+
+std::shared_ptr<ov::AlignedBuffer> ImportedPackedWeights::getSource(uint64_t id, size_t size) const {
+    auto found = m_weights.find(id);
+    if (found == m_weights.end()) {
+        return nullptr;
+    }
+    const auto& stored = found->second.front();
+    OPENVINO_ASSERT(size <= stored.size, "[CPU] Packed weights are smaller than the source weights");
+    // the content is not the source weights, it is only read through find()
+    return std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+        m_buffer->get_ptr<char>() + stored.offset,
+        size,
+        m_buffer);
+}
+
+MemoryPtr ImportedPackedWeights::find(const void* source, const dnnl::engine& eng, const MemoryDesc& desc) const {
+    auto id = m_sources.find(source);
+    if (id == m_sources.end()) {
+        return nullptr;
+    }
+    const auto& stored = m_weights.at(id->second);
+    auto found = std::find_if(stored.begin(), stored.end(), [&](const StoredWeights& weights) {
+        return weights.desc->isCompatible(desc);
+    });
+    if (found == stored.end()) {
+        found = stored.begin();
+    }
+    // the blob may be mapped read only, so the padding is not zeroed, it was zeroed before the export
+    auto* memory = new Memory(eng, found->desc, m_buffer->get_ptr<char>() + found->offset, false);
+    return {memory, [buffer = m_buffer](Memory* memory) {
+                delete memory;
+            }};
+}
+
 WeightsSharing::SharedMemory::SharedMemory(std::unique_lock<std::mutex>&& lock,
                                            MemoryInfo::Ptr memory,
                                            MemoryPtr newPtr)
@@ -93,6 +138,35 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
+void WeightsSharing::trackPacked(const MemoryCPtr& source, const MemoryCPtr& packed) {
+    std::lock_guard<std::mutex> lock(guard);
+    // the list is pruned once it doubles, so the compiled models released in the meantime do not accumulate
+    if (packedWeights.size() >= packedWeightsPruneSize) {
+        packedWeights.erase(std::remove_if(packedWeights.begin(),
+                                           packedWeights.end(),
+                                           [](const PackedInfo& info) {
+                                               return info.source.expired() || info.packed.expired();
+                                           }),
+                            packedWeights.end());
+        packedWeightsPruneSize = std::max(packedWeightsPruneSize, 2 * packedWeights.size());
+    }
+    packedWeights.push_back({source, packed});
+}
+
+PackedWeightsList WeightsSharing::getPacked() const {
+    PackedWeightsList result;
+    std::lock_guard<std::mutex> lock(guard);
+    for (const auto& info : packedWeights) {
+        auto source = info.source.lock();
+        auto packed = info.packed.lock();
+        if (!source || !packed) {
+            continue;
+        }
+        result.push_back({std::move(source), std::move(packed)});
+    }
+    return result;
+}
+
 SocketsWeights::SocketsWeights() {
     int num_sockets = get_num_sockets();
     for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
@@ -112,6 +186,29 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
     return found->second;
 }
 
+PackedWeightsList SocketsWeights::getPacked() const {
+    PackedWeightsList result;
+    for (const auto& item : _cache_map) {
+        for (auto& weights : item.second->getPacked()) {
+            const bool packedForOtherSocket =
+                std::any_of(result.begin(), result.end(), [&](const PackedWeights& other) {
+                    return other.source->getData() == weights.source->getData() &&
+                           other.packed->getDesc().isCompatible(weights.packed->getDesc());
+                });
+            if (!packedForOtherSocket) {
+                result.push_back(std::move(weights));
+            }
+        }
+    }
+    return result;
+}
+
+void SocketsWeights::setImportedPacked(const ImportedPackedWeights::Ptr& imported) {
+    for (auto& item : _cache_map) {
+        item.second->setImportedPacked(imported);
+    }
+}
+
 #ifdef CPU_DEBUG_CAPS
 WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
     Statistics retVal = {0, 0};
@@ -6,6 +6,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -16,6 +17,8 @@
 #include <vector>
 
 #include "cpu_memory.h"
+#include "memory_desc/dnnl_memory_desc.h"
+#include "openvino/runtime/aligned_buffer.hpp"
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -24,6 +27,63 @@
 //       classes at all.
 
 namespace ov::intel_cpu {
+/**
+ * The weights reordered to the final layout along with the source weights they were reordered from
+ */
+struct PackedWeights {
+    MemoryCPtr source;
+    MemoryCPtr packed;
+};
+
+using PackedWeightsList = std::vector<PackedWeights>;
+
+/**
+ * The packed weights stored in the compiled blob instead of their source weights
+ * Each source constant is identified by the id assigned on export. The constant refers to the first stored copy, so the
+ * source weights are recognized by the address. The data is used in place, so the processes importing the same memory
+ * mapped blob share the pages
+ *
+ * Is not thread safe for modification, filled before the compilation
+ */
+class ImportedPackedWeights {
+public:
+    using Ptr = std::shared_ptr<ImportedPackedWeights>;
+
+    explicit ImportedPackedWeights(std::shared_ptr<ov::AlignedBuffer> buffer) : m_buffer(std::move(buffer)) {}
+
+    void add(uint64_t id, size_t offset, size_t size, DnnlMemoryDescPtr desc);
+
+    /**
+     * Returns the buffer the source constant with the id refers to or nullptr if the weights are not stored
+     */
+    [[nodiscard]] std::shared_ptr<ov::AlignedBuffer> getSource(uint64_t id, size_t size) const;
+
+    [[nodiscard]] bool isSource(const void* data) const {
+        return m_sources.count(data) != 0;
+    }
+
+    /**
+     * Returns the stored copy of the source weights at the address in the requested layout. If the layout is not
+     * stored, returns any stored copy to reorder from. Returns nullptr if the address is not the source weights
+     */
+    [[nodiscard]] MemoryPtr find(const void* source, const dnnl::engine& eng, const MemoryDesc& desc) const;
+
+    [[nodiscard]] bool empty() const {
+        return m_weights.empty();
+    }
+
+private:
+    struct StoredWeights {
+        size_t offset;
+        size_t size;
+        DnnlMemoryDescPtr desc;
+    };
+
+    std::shared_ptr<ov::AlignedBuffer> m_buffer;
+    std::unordered_map<uint64_t, std::vector<StoredWeights>> m_weights;
+    std::unordered_map<const void*, uint64_t> m_sources;
+};
+
 /**
  * Caching store of Memory objects
  * Will return a cached object or create new one
@@ -73,6 +133,25 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * Remembers the weights reordered to the final layout to store them in the compiled blob
+     * The entries of the released weights are dropped on the way
+     */
+    void trackPacked(const MemoryCPtr& source, const MemoryCPtr& packed);
+
+    /**
+     * Returns the tracked weights which are still in use
+     */
+    [[nodiscard]] PackedWeightsList getPacked() const;
+
+    void setImportedPacked(ImportedPackedWeights::Ptr imported) {
+        importedPacked = std::move(imported);
+    }
+
+    [[nodiscard]] const ImportedPackedWeights::Ptr& getImportedPacked() const {
+        return importedPacked;
+    }
+
 #ifdef CPU_DEBUG_CAPS
     Statistics dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
@@ -80,6 +159,14 @@ public:
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+
+    struct PackedInfo {
+        std::weak_ptr<const IMemory> source;
+        std::weak_ptr<const IMemory> packed;
+    };
+    std::vector<PackedInfo> packedWeights;
+    size_t packedWeightsPruneSize = 64;
+    ImportedPackedWeights::Ptr importedPacked;
 };
 
 /**
@@ -94,6 +181,13 @@ public:
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
 
+    /**
+     * Returns the packed weights of all the sockets, the weights packed for several sockets are returned once
+     */
+    [[nodiscard]] PackedWeightsList getPacked() const;
+
+    void setImportedPacked(const ImportedPackedWeights::Ptr& imported);
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] std::vector<std::pair<int, WeightsSharing::Statistics>> dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
@@ -7,8 +7,10 @@
 #include "common_test_utils/test_common.hpp"
 #include "common_test_utils/node_builders/eltwise.hpp"
 #include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
 #include "openvino/opsets/opset9_decl.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/softmax.hpp"
 #include "openvino/opsets/opset9_decl.hpp"
@@ -94,6 +96,91 @@ TEST_P(ExportOptimalNumStreams, OptimalNumStreams) {
     }
 }
 
+TEST(ExportImportPackedWeights, ImportedModelMatchesCompiled) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    ov::Core core;
+    auto compiled_model = core.compile_model(MakeMatMulModel(), "CPU");
+
+    std::stringstream exported_model;
+    compiled_model.export_model(exported_model);
+    const auto blob = exported_model.str();
+    // the packed weights are stored instead of the source weights, not along with them
+    EXPECT_LT(blob.size(), 2 * 4096 * 1024 * sizeof(float));
+
+    auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{1, 4096});
+    auto infer = [&](ov::CompiledModel& model) {
+        auto request = model.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        const auto output = request.get_output_tensor();
+        const auto* data = output.data<float>();
+        return std::vector<float>(data, data + output.get_size());
+    };
+    const auto expected = infer(compiled_model);
+
+    // the packed weights are copied from the stream
+    {
+        std::stringstream ss(blob);
+        auto imported_model = core.import_model(ss, "CPU");
+        EXPECT_EQ(expected, infer(imported_model));
+    }
+    // the packed weights are used in place
+    {
+        ov::Tensor blob_tensor(ov::element::u8, ov::Shape{blob.size()});
+        std::memcpy(blob_tensor.data(), blob.data(), blob.size());
+        auto imported_model = core.import_model(blob_tensor, "CPU");
+        EXPECT_EQ(expected, infer(imported_model));
+    }
+    // the imported model stores the same packed weights once exported again
+    {
+        std::stringstream ss(blob);
+        auto imported_model = core.import_model(ss, "CPU");
+        EXPECT_EQ(expected, infer(imported_model));
+        std::stringstream reexported_model;
+        imported_model.export_model(reexported_model);
+        EXPECT_LT(reexported_model.str().size(), 2 * 4096 * 1024 * sizeof(float));
+        auto reimported_model = core.import_model(reexported_model, "CPU");
+        EXPECT_EQ(expected, infer(reimported_model));
+    }
+}
+
+TEST(ExportImportPackedWeights, WeightsSharedWithGather) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    // the embeddings table is tied with the weights of the output projection, the Gather reads it in the plain layout
+    auto ids = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::Shape{1, 8});
+    auto table = ov::test::utils::make_constant(ov::element::f32, {1024, 256});
+    auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+    auto embeddings = std::make_shared<ov::op::v8::Gather>(table, ids, axis);
+    auto logits = std::make_shared<ov::op::v0::MatMul>(embeddings, table, false, true);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{logits}, ov::ParameterVector{ids}, "TiedEmbeddings");
+
+    ov::Core core;
+    auto compiled_model = core.compile_model(model, "CPU");
+    std::stringstream exported_model;
+    compiled_model.export_model(exported_model);
+    const auto blob = exported_model.str();
+
+    auto input = ov::test::utils::create_and_fill_tensor(ov::element::i32, ov::Shape{1, 8}, 1023);
+    auto infer = [&](ov::CompiledModel& model) {
+        auto request = model.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        const auto output = request.get_output_tensor();
+        const auto* data = output.data<float>();
+        return std::vector<float>(data, data + output.get_size());
+    };
+    const auto expected = infer(compiled_model);
+
+    std::stringstream ss(blob);
+    auto imported_model = core.import_model(ss, "CPU");
+    EXPECT_EQ(expected, infer(imported_model));
+
+    ov::Tensor blob_tensor(ov::element::u8, ov::Shape{blob.size()});
+    std::memcpy(blob_tensor.data(), blob.data(), blob.size());
+    auto mapped_model = core.import_model(blob_tensor, "CPU");
+    EXPECT_EQ(expected, infer(mapped_model));
+}
+
 const std::vector<ov::AnyMap> testing_property_for_streams = {{ov::num_streams(1)}, {ov::num_streams(2)}};
 
 const std::vector<ov::AnyMap> testing_property_for_threads = {{ov::inference_num_threads(1)},
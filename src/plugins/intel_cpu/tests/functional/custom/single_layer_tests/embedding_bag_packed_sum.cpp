@@ -3,6 +3,7 @@
 //
 
 #include "common_test_utils/node_builders/embedding_bag_packed_sum.hpp"
+#include "openvino/runtime/system_conf.hpp"
 
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "utils/cpu_test_utils.hpp"
@@ -47,7 +48,12 @@ protected:
         inType = _inType;
         targetDevice = _targetDevice;
         const auto& [inputShapes, indices, withWeights] = embParams;
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // f32 tables are reduced by the jit kernel on AVX2 capable hosts, the integer ones by the reference code
+        if (inType == ElementType::f32 && ov::with_cpu_x86_avx2()) {
+            selectedType = makeSelectedTypeStr(getPrimitiveType(), inType);
+        } else {
+            selectedType = makeSelectedTypeStr("ref_any", inType == ElementType::u8 ? ov::element::i8 : inType);
+        }
         targetDevice = ov::test::utils::DEVICE_CPU;
 
         init_input_shapes({inputShapes});
@@ -64,7 +70,7 @@ protected:
 
 TEST_P(EmbeddingBagPackedSumLayerCPUTest, CompareWithRefs) {
     run();
-    CheckPluginRelatedResults(compiledModel, "embeddingBagPackedSum");
+    CheckPluginRelatedResults(compiledModel, "EmbeddingBagPacked");
 }
 
 namespace {
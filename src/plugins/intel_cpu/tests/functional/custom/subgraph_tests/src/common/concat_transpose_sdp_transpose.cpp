@@ -389,6 +389,76 @@ INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeByChannelTest,
 
 }  //  namespace
 
+// The states of the request are forked into another request after the first inference,
+// then both requests continue with the same inputs
+class ConcatSDPTransposeTestForkState : public ConcatSDPTransposeTestBase {
+public:
+    void fork_state(ov::InferRequest& forkedRequest) {
+        auto states = inferRequest.query_state();
+        for (auto&& state : forkedRequest.query_state()) {
+            auto itr = std::find_if(states.begin(), states.end(), [&](const ov::VariableState& source) {
+                return source.get_name() == state.get_name();
+            });
+            OPENVINO_ASSERT(itr != states.end(), "Failed to find ", state.get_name(), " state");
+            state.set_state(*itr);
+        }
+    }
+    std::vector<ov::Tensor> run_test(std::shared_ptr<ov::Model> model) {
+        function = model;
+        prepare();
+        auto forkedRequest = compiledModel.create_infer_request();
+        std::vector<ov::Tensor> outputs;
+        auto infer = [&](ov::InferRequest& request) {
+            for (const auto& input : inputs) {
+                request.set_tensor(input.first, input.second);
+            }
+            request.infer();
+            auto outputTensor = request.get_output_tensor(0);
+            ov::Tensor copy{outputTensor.get_element_type(), outputTensor.get_shape()};
+            outputTensor.copy_to(copy);
+            outputs.push_back(copy);
+        };
+        int idx = 0;
+        for (auto&& shapes : targetStaticShapes) {
+            generate(idx, shapes);
+            infer(inferRequest);
+            if (idx == 0) {
+                fork_state(forkedRequest);
+            } else {
+                infer(forkedRequest);
+            }
+            idx++;
+        }
+        return outputs;
+    }
+};
+
+TEST_P(ConcatSDPTransposeTestForkState, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto actualOutputs = run_test(function);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+    auto expectedOutputs = run_test(functionRefs);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 0);
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+    }
+    // the forked request produces the same outputs as the original one
+    for (size_t i = 1; i + 1 < actualOutputs.size(); i += 2) {
+        ov::test::utils::compare(actualOutputs[i], actualOutputs[i + 1], abs_threshold, rel_threshold);
+    }
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeTestForkState,
+                         ConcatSDPTransposeTestForkState,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(inputShapeAndReorders),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false),
+                                            ::testing::Values(0)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+}  // namespace
+
 class ConcatSDPTransposeTestSetState : public ConcatSDPTransposeTestBase {
 public:
     void reduce_state() {
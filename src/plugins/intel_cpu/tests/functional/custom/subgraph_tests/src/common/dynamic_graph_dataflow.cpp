@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/softmax.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                             param
+                  /       /         \        \
+              MatMul   MatMul     MatMul   MatMul
+                |        |          |        |
+               Relu     Add       Softmax   Relu
+                |        |          |        |
+               Add      Relu       Add    Multiply
+                  \       \         /        /
+                             Concat
+                               |
+                             Result
+
+The main purpose of the test is to check that the independent branches of a dynamic graph produce correct results
+being executed concurrently (see DYNAMIC_GRAPH_CONCURRENCY) and the memory of the concurrent nodes is not shared.
+*/
+
+namespace ov {
+namespace test {
+
+class DynamicGraphDataflow : public testing::WithParamInterface<int32_t>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<int32_t>& obj) {
+        return "concurrency=" + std::to_string(obj.param);
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration[ov::intel_cpu::dynamic_graph_concurrency.name()] = GetParam();
+
+        const auto precision = ov::element::f32;
+        InputShape inputShape{{-1, -1, 32}, {{1, 10, 32}, {2, 7, 32}, {1, 1, 32}, {1, 10, 32}}};
+        init_input_shapes({inputShape});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        auto addConst = ov::test::utils::make_constant(precision, ov::Shape{1, 1, 16});
+
+        ov::OutputVector branches;
+        for (size_t i = 0; i < 4; i++) {
+            auto weights = ov::test::utils::make_constant(precision, ov::Shape{32, 16});
+            std::shared_ptr<ov::Node> branch = std::make_shared<ov::op::v0::MatMul>(param, weights);
+            switch (i) {
+            case 0:
+                branch = std::make_shared<ov::op::v0::Relu>(branch);
+                branch = utils::make_eltwise(branch, addConst, utils::EltwiseTypes::ADD);
+                break;
+            case 1:
+                branch = utils::make_eltwise(branch, addConst, utils::EltwiseTypes::ADD);
+                branch = std::make_shared<ov::op::v0::Relu>(branch);
+                break;
+            case 2:
+                branch = std::make_shared<ov::op::v8::Softmax>(branch, -1);
+                branch = utils::make_eltwise(branch, addConst, utils::EltwiseTypes::ADD);
+                break;
+            default:
+                branch = std::make_shared<ov::op::v0::Relu>(branch);
+                branch = utils::make_eltwise(branch, addConst, utils::EltwiseTypes::MULTIPLY);
+                break;
+            }
+            branches.push_back(branch);
+        }
+
+        auto concat = std::make_shared<ov::op::v0::Concat>(branches, -1);
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(concat)};
+        function = std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "DynamicGraphDataflow");
+    }
+};
+
+TEST_P(DynamicGraphDataflow, CompareWithRefs) {
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicGraphDataflow,
+                         DynamicGraphDataflow,
+                         ::testing::Values(1, 2, 4),
+                         DynamicGraphDataflow::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,245 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/subgraph_builders/weights_decompression_builders.hpp"
+#include "openvino/op/embedding_segments_sum.hpp"
+#include "openvino/op/embeddingbag_offsets.hpp"
+#include "openvino/op/embeddingbag_packed.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/util/embeddingbag_offsets_base.hpp"
+#include "openvino/op/util/embeddingbag_packed_base.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+/*
+ * The embedding table is a compressed constant, so its decompression subgraph is expected to be fused into the
+ * embedding node, which decompresses only the gathered rows:
+ *
+ *         Constant(f16/i8/u8)
+ *                 |
+ *              Convert
+ *                 |
+ *       [Subtract(zero point)]
+ *                 |
+ *         [Multiply(scale)]   Parameter(indices)   [Parameter(per sample weights)]
+ *                  \                 |                 /
+ *                   EmbeddingBagOffsets / EmbeddingBagPacked / EmbeddingSegmentsSum
+ *
+ * The per sample weights are used with the SUM reduction only.
+ */
+enum class EmbeddingType { OFFSETS, PACKED, SEGMENTS };
+
+using Reduction = ov::op::util::EmbeddingBagOffsetsBase::Reduction;
+
+using EmbeddingBagDecompressionParams = std::tuple<EmbeddingType,
+                                                   Reduction,
+                                                   ov::element::Type,          // table precision
+                                                   utils::DecompressionType,   // multiply
+                                                   utils::DecompressionType>;  // subtract
+
+class EmbeddingBagDecompression : public testing::WithParamInterface<EmbeddingBagDecompressionParams>,
+                                  virtual public SubgraphBaseTest,
+                                  public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagDecompressionParams>& obj) {
+        const auto& [embeddingType, reduction, tablePrc, multiplyType, subtractType] = obj.param;
+        std::ostringstream result;
+        result << "Embedding=" << embeddingTypeName(embeddingType) << "_";
+        result << "Reduction=" << (reduction == Reduction::SUM ? "SUM" : "MEAN") << "_";
+        result << "TablePrc=" << tablePrc << "_";
+        result << "Multiply=" << multiplyType << "_";
+        result << "Subtract=" << subtractType;
+        return result.str();
+    }
+
+protected:
+    static std::string embeddingTypeName(EmbeddingType type) {
+        switch (type) {
+        case EmbeddingType::OFFSETS:
+            return "EmbeddingBagOffsets";
+        case EmbeddingType::PACKED:
+            return "EmbeddingBagPacked";
+        case EmbeddingType::SEGMENTS:
+            return "EmbeddingSegmentsSum";
+        }
+        return "";
+    }
+
+    void SetUp() override {
+        const auto& [embeddingType, reduction, tablePrc, multiplyType, subtractType] = this->GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        abs_threshold = 1e-3;
+
+        // the compressed tables are reduced by the jit kernel on AVX2 capable hosts
+        const auto implPrc = tablePrc == ov::element::u8 ? ov::element::i8 : tablePrc;
+        selectedType = makeSelectedTypeStr(ov::with_cpu_x86_avx2() ? getPrimitiveType() : "ref_any", implPrc);
+        nodeType = embeddingTypeName(embeddingType);
+
+        // The depth is not a multiple of the vector length to cover the tails
+        const ov::Shape tableShape{TABLE_ROWS, 150};
+        const auto table = utils::initGatherDecompressionSubgraph(tableShape,
+                                                                  -1,
+                                                                  tablePrc,
+                                                                  ov::element::f32,
+                                                                  multiplyType,
+                                                                  subtractType,
+                                                                  false);
+
+        const auto indicesShape = embeddingType == EmbeddingType::PACKED ? ov::Shape{3, 4} : ov::Shape{12};
+        const bool withWeights = reduction == Reduction::SUM;
+        init_input_shapes(withWeights ? std::vector<InputShape>{{{}, {indicesShape}}, {{}, {indicesShape}}}
+                                      : std::vector<InputShape>{{{}, {indicesShape}}});
+        auto indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, indicesShape);
+        ov::ParameterVector params{indices};
+        std::shared_ptr<ov::op::v0::Parameter> weights;
+        if (withWeights) {
+            weights = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, indicesShape);
+            params.push_back(weights);
+        }
+        auto defaultIndex = utils::make_constant(ov::element::i32, ov::Shape{}, std::vector<int32_t>{5});
+
+        std::shared_ptr<ov::Node> embedding;
+        switch (embeddingType) {
+        case EmbeddingType::OFFSETS: {
+            // the second bag is empty, so it is filled with the default row
+            auto offsets = utils::make_constant(ov::element::i32, ov::Shape{4}, std::vector<int32_t>{0, 4, 4, 9});
+            embedding = withWeights ? std::make_shared<ov::op::v15::EmbeddingBagOffsets>(table,
+                                                                                         indices,
+                                                                                         offsets,
+                                                                                         defaultIndex,
+                                                                                         weights,
+                                                                                         reduction)
+                                    : std::make_shared<ov::op::v15::EmbeddingBagOffsets>(table,
+                                                                                         indices,
+                                                                                         offsets,
+                                                                                         defaultIndex,
+                                                                                         reduction);
+            break;
+        }
+        case EmbeddingType::PACKED: {
+            const auto packedReduction = reduction == Reduction::SUM
+                                             ? ov::op::util::EmbeddingBagPackedBase::Reduction::SUM
+                                             : ov::op::util::EmbeddingBagPackedBase::Reduction::MEAN;
+            embedding = withWeights
+                            ? std::make_shared<ov::op::v15::EmbeddingBagPacked>(table, indices, weights, packedReduction)
+                            : std::make_shared<ov::op::v15::EmbeddingBagPacked>(table, indices, packedReduction);
+            break;
+        }
+        case EmbeddingType::SEGMENTS: {
+            OPENVINO_ASSERT(withWeights, "EmbeddingSegmentsSum supports the SUM reduction only");
+            // the segments 2 and 4 are empty, so they are filled with the default row
+            auto segmentIds =
+                utils::make_constant(ov::element::i32,
+                                     indicesShape,
+                                     std::vector<int32_t>{0, 0, 1, 1, 1, 3, 3, 3, 3, 5, 5, 5});
+            auto numSegments = utils::make_constant(ov::element::i32, ov::Shape{}, std::vector<int32_t>{6});
+            embedding = std::make_shared<ov::op::v3::EmbeddingSegmentsSum>(table,
+                                                                           indices,
+                                                                           segmentIds,
+                                                                           numSegments,
+                                                                           defaultIndex,
+                                                                           weights);
+            break;
+        }
+        }
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{embedding}, params, "EmbeddingBagDecompression");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& funcInput = funcInputs[i];
+            utils::InputGenerateData in_data;
+            if (funcInput.get_element_type().is_integral()) {
+                // valid row indices of the table
+                in_data.start_from = 0;
+                in_data.range = TABLE_ROWS;
+                in_data.resolution = 1;
+            } else {
+                in_data.start_from = -1;
+                in_data.range = 2;
+                in_data.resolution = 1000;
+            }
+            inputs.insert({funcInput.get_node_shared_ptr(),
+                           utils::create_and_fill_tensor(funcInput.get_element_type(),
+                                                         targetInputStaticShapes[i],
+                                                         in_data)});
+        }
+    }
+
+    void check_results() {
+        CheckNumberOfNodesWithTypes(compiledModel, {"Convert", "Eltwise", "Subgraph"}, 0);
+        CheckPluginRelatedResults(compiledModel, nodeType);
+    }
+
+    static constexpr size_t TABLE_ROWS = 30;
+    std::string nodeType;
+};
+
+TEST_P(EmbeddingBagDecompression, CompareWithRefs) {
+    run();
+    check_results();
+}
+
+namespace {
+
+const std::vector<EmbeddingType> embeddingTypes = {EmbeddingType::OFFSETS,
+                                                   EmbeddingType::PACKED,
+                                                   EmbeddingType::SEGMENTS};
+
+const std::vector<EmbeddingType> embeddingBagTypes = {EmbeddingType::OFFSETS, EmbeddingType::PACKED};
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagDecompression_Float,
+                         EmbeddingBagDecompression,
+                         ::testing::Combine(::testing::ValuesIn(embeddingTypes),
+                                            ::testing::Values(Reduction::SUM),
+                                            ::testing::Values(ov::element::f16, ov::element::bf16),
+                                            ::testing::Values(utils::DecompressionType::empty),
+                                            ::testing::Values(utils::DecompressionType::empty)),
+                         EmbeddingBagDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagDecompression_Integer,
+                         EmbeddingBagDecompression,
+                         ::testing::Combine(::testing::ValuesIn(embeddingTypes),
+                                            ::testing::Values(Reduction::SUM),
+                                            ::testing::Values(ov::element::u8, ov::element::i8),
+                                            ::testing::Values(utils::DecompressionType::full,
+                                                              utils::DecompressionType::scalar),
+                                            ::testing::Values(utils::DecompressionType::empty,
+                                                              utils::DecompressionType::full,
+                                                              utils::DecompressionType::scalar)),
+                         EmbeddingBagDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagDecompression_Float_Mean,
+                         EmbeddingBagDecompression,
+                         ::testing::Combine(::testing::ValuesIn(embeddingBagTypes),
+                                            ::testing::Values(Reduction::MEAN),
+                                            ::testing::Values(ov::element::f16),
+                                            ::testing::Values(utils::DecompressionType::empty),
+                                            ::testing::Values(utils::DecompressionType::empty)),
+                         EmbeddingBagDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagDecompression_Integer_Mean,
+                         EmbeddingBagDecompression,
+                         ::testing::Combine(::testing::ValuesIn(embeddingBagTypes),
+                                            ::testing::Values(Reduction::MEAN),
+                                            ::testing::Values(ov::element::u8),
+                                            ::testing::Values(utils::DecompressionType::full),
+                                            ::testing::Values(utils::DecompressionType::empty,
+                                                              utils::DecompressionType::full)),
+                         EmbeddingBagDecompression::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -380,6 +380,30 @@ INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_sym_non_default_dyn_quant
                                             ::testing::Values(true)),
                          MatmulWeightsDecompression::getTestCaseName);
 
+// weight groups finer than the default dynamic quantization group of 32 (GGUF Q6_K layout: i8 + group-16 scales)
+const std::vector<ov::AnyMap> additional_config_fine_groups_dyn_quant = {
+    {},
+};
+const std::vector<MatMulDecompressionShapeParams> input_shapes_fine_groups_dyn_quant = {
+    {{{}, {{1, 7, 256}}}, {256, 128}, 16lu},
+    {{{-1, -1, -1}, {{1, 1, 512}, {3, 5, 512}}}, {512, 64}, 16lu},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_sym_fine_groups_dyn_quant,
+                         MatmulWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes_fine_groups_dyn_quant),
+                                            ::testing::Values(ov::element::i8),
+                                            ::testing::ValuesIn(decompression_precisions),
+                                            ::testing::Values(ov::element::dynamic),
+                                            ::testing::Values(true),
+                                            ::testing::Values(DecompressionType::full),
+                                            ::testing::Values(DecompressionType::empty),
+                                            ::testing::Values(false),
+                                            ::testing::ValuesIn(additional_config_fine_groups_dyn_quant),
+                                            ::testing::Values(emptyFusingSpec),
+                                            ::testing::Values(true)),
+                         MatmulWeightsDecompression::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_mxfp4,
                          MatmulWeightsDecompression,
                          ::testing::Combine(::testing::ValuesIn(input_shapes_basic_dyn_quant),
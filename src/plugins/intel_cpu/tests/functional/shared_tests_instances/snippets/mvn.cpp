@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/mvn.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+namespace {
+
+// the MVN chain is tokenized on x64 only
+#if defined(OPENVINO_ARCH_X86_64)
+
+// snippets ignore_callback is set in setup, so these tests will always run as snippets
+const std::vector<std::vector<ov::Shape>> inputShapes = {
+    // standalone MVN with the post-ops
+    {{2, 16, 64}},
+    {{1, 3, 7}},
+    // residual Add + MVN with the post-ops
+    {{2, 16, 64}, {2, 16, 64}},
+    {{32, 768}, {32, 768}},
+    {{1, 5, 33}, {1, 5, 33}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_MVN, MVN,
+                     ::testing::Combine(
+                             ::testing::ValuesIn(ov::test::static_shapes_to_test_representation(inputShapes)),
+                             ::testing::Values(MVNFunction::PostOp::None,
+                                               MVNFunction::PostOp::FakeQuantize,
+                                               MVNFunction::PostOp::Convert),
+                             ::testing::Values(1),              // expected node number
+                             ::testing::Values(1),              // expected subgraph number
+                             ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                     MVN::getTestCaseName);
+
+#endif
+
+} // namespace
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "config.h"
+#include "graph_context.h"
+
+using namespace ov::intel_cpu;
+
+TEST(GraphContextTest, SnippetsKernelCacheIsSharedByContexts) {
+    Config conf;
+    auto first = std::make_shared<GraphContext>(conf, nullptr, false);
+    auto second = std::make_shared<GraphContext>(conf, nullptr, false);
+
+    ASSERT_NE(first->getSnippetsKernelCache(), nullptr);
+    ASSERT_TRUE(first->getSnippetsKernelCache()->isThreadSafe());
+    ASSERT_EQ(first->getSnippetsKernelCache(), second->getSnippetsKernelCache());
+    // the graph caches are still private as they hold the dynamic kernels updated at runtime
+    ASSERT_NE(first->getSnippetsParamsCache(), second->getSnippetsParamsCache());
+}
+
+TEST(GraphContextTest, SnippetsKernelCacheIsReleasedWithContexts) {
+    Config conf;
+    auto context = std::make_shared<GraphContext>(conf, nullptr, false);
+    std::weak_ptr<MultiCache> cache = context->getSnippetsKernelCache();
+    ASSERT_FALSE(cache.expired());
+
+    context.reset();
+    ASSERT_TRUE(cache.expired());
+}
+
+TEST(GraphContextTest, SnippetsKernelCacheIsSeparatedByInferencePrecision) {
+    Config conf;
+    conf.inferencePrecision = ov::element::f32;
+    auto f32Context = std::make_shared<GraphContext>(conf, nullptr, false);
+    conf.inferencePrecision = ov::element::bf16;
+    auto bf16Context = std::make_shared<GraphContext>(conf, nullptr, false);
+
+    ASSERT_NE(f32Context->getSnippetsKernelCache(), bf16Context->getSnippetsKernelCache());
+}
+
+TEST(GraphContextTest, SnippetsKernelCacheIsDisabledWithSnippetsCache) {
+    Config conf;
+    conf.snippetsCacheCapacity = 0;
+    auto context = std::make_shared<GraphContext>(conf, nullptr, false);
+
+    ASSERT_EQ(context->getSnippetsKernelCache(), nullptr);
+}
@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "nodes/kernels/scaled_attn/kv_cache_paging.hpp"
+#include "openvino/util/memory.hpp"
+
+using namespace ov::Extensions::Cpu;
+
+namespace {
+
+constexpr size_t blockBytes = 4 * ov::util::min_page_alignment;
+constexpr size_t numBlocks = 4;
+
+struct AlignedBuffer {
+    AlignedBuffer() : data(static_cast<uint8_t*>(ov::util::aligned_alloc(blockBytes * numBlocks, blockBytes))) {
+        for (size_t i = 0; i < blockBytes * numBlocks; i++) {
+            data[i] = static_cast<uint8_t>(i / blockBytes);
+        }
+    }
+    ~AlignedBuffer() {
+        ov::util::aligned_free(data);
+    }
+    uint8_t* data;
+};
+
+}  // namespace
+
+TEST(KVCachePagingTest, PagesOutLeastRecentlyUsedBlocks) {
+    AlignedBuffer cache;
+    KVCachePaging paging(2 * blockBytes);
+    const auto slot = paging.register_cache();
+
+    const std::vector<int32_t> first{0, 1};
+    paging.access(slot, cache.data, numBlocks, blockBytes, first.data(), first.size());
+    ASSERT_EQ(2 * blockBytes, paging.resident_size());
+
+    const std::vector<int32_t> second{2, 1};
+    paging.next_step();
+    paging.access(slot, cache.data, numBlocks, blockBytes, second.data(), second.size());
+    ASSERT_EQ(2 * blockBytes, paging.resident_size());
+    ASSERT_EQ(1u, paging.paged_out_blocks());
+    ASSERT_FALSE(paging.is_resident(slot, 0));
+    ASSERT_TRUE(paging.is_resident(slot, 1));
+    ASSERT_TRUE(paging.is_resident(slot, 2));
+
+    // the paged out block is brought back and the content is preserved
+    const std::vector<int32_t> third{0};
+    paging.next_step();
+    paging.access(slot, cache.data, numBlocks, blockBytes, third.data(), third.size());
+    ASSERT_TRUE(paging.is_resident(slot, 0));
+    ASSERT_TRUE(paging.is_resident(slot, 1));
+    ASSERT_FALSE(paging.is_resident(slot, 2));
+    for (size_t i = 0; i < blockBytes * numBlocks; i++) {
+        ASSERT_EQ(static_cast<uint8_t>(i / blockBytes), cache.data[i]);
+    }
+}
+
+TEST(KVCachePagingTest, BlocksOfCurrentStepAreNotPagedOut) {
+    AlignedBuffer cache;
+    KVCachePaging paging(blockBytes);
+    const auto slot = paging.register_cache();
+
+    const std::vector<int32_t> blocks{0, 1, 2};
+    paging.access(slot, cache.data, numBlocks, blockBytes, blocks.data(), blocks.size());
+    ASSERT_EQ(3 * blockBytes, paging.resident_size());
+    ASSERT_EQ(0u, paging.paged_out_blocks());
+}
+
+TEST(KVCachePagingTest, BlocksOfCurrentStepAreKeptForAllCaches) {
+    AlignedBuffer keyCache;
+    AlignedBuffer valueCache;
+    KVCachePaging paging(blockBytes);
+    const auto keySlot = paging.register_cache();
+    const auto valueSlot = paging.register_cache();
+
+    // the key blocks are not paged out while the value blocks of the same step are accessed
+    const std::vector<int32_t> blocks{0, 1};
+    paging.access(keySlot, keyCache.data, numBlocks, blockBytes, blocks.data(), blocks.size());
+    paging.access(valueSlot, valueCache.data, numBlocks, blockBytes, blocks.data(), blocks.size());
+    ASSERT_EQ(4 * blockBytes, paging.resident_size());
+    ASSERT_EQ(0u, paging.paged_out_blocks());
+
+    // the blocks of the previous step are paged out once they are not used
+    const std::vector<int32_t> next{2};
+    paging.next_step();
+    paging.access(keySlot, keyCache.data, numBlocks, blockBytes, next.data(), next.size());
+    ASSERT_EQ(blockBytes, paging.resident_size());
+    ASSERT_EQ(4u, paging.paged_out_blocks());
+    ASSERT_TRUE(paging.is_resident(keySlot, 2));
+}
+
+TEST(KVCachePagingTest, PagedOutBlockIsPrefetchedForAllCaches) {
+    AlignedBuffer keyCache;
+    AlignedBuffer valueCache;
+    KVCachePaging paging(2 * blockBytes);
+    const auto keySlot = paging.register_cache();
+    const auto valueSlot = paging.register_cache();
+
+    const std::vector<int32_t> first{0};
+    paging.access(keySlot, keyCache.data, numBlocks, blockBytes, first.data(), first.size());
+    paging.access(valueSlot, valueCache.data, numBlocks, blockBytes, first.data(), first.size());
+    const std::vector<int32_t> second{1};
+    paging.next_step();
+    paging.access(keySlot, keyCache.data, numBlocks, blockBytes, second.data(), second.size());
+    paging.access(valueSlot, valueCache.data, numBlocks, blockBytes, second.data(), second.size());
+    ASSERT_FALSE(paging.is_resident(keySlot, 0));
+    ASSERT_FALSE(paging.is_resident(valueSlot, 0));
+
+    // the block is prefetched for the value cache ahead of its access
+    paging.next_step();
+    paging.access(keySlot, keyCache.data, numBlocks, blockBytes, first.data(), first.size());
+    ASSERT_TRUE(paging.is_resident(keySlot, 0));
+    ASSERT_TRUE(paging.is_resident(valueSlot, 0));
+}
+
+TEST(KVCachePagingTest, ReallocatedCacheIsTrackedFromScratch) {
+    AlignedBuffer cache;
+    AlignedBuffer newCache;
+    KVCachePaging paging(blockBytes);
+    const auto slot = paging.register_cache();
+
+    const std::vector<int32_t> first{0};
+    const std::vector<int32_t> second{1};
+    paging.access(slot, cache.data, numBlocks, blockBytes, first.data(), first.size());
+    paging.next_step();
+    paging.access(slot, cache.data, numBlocks, blockBytes, second.data(), second.size());
+    ASSERT_EQ(1u, paging.paged_out_blocks());
+
+    paging.next_step();
+    paging.access(slot, newCache.data, numBlocks, blockBytes, first.data(), first.size());
+    ASSERT_EQ(0u, paging.paged_out_blocks());
+    ASSERT_EQ(blockBytes, paging.resident_size());
+}
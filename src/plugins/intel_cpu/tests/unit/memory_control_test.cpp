@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "memory_control.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+MemoryRegion dynamicRegion(int start, int finish, int64_t id) {
+    return {start, finish, -1, id, MemoryRegion::RegionType::VARIABLE, MemoryRegion::AllocType::POD};
+}
+
+}  // namespace
+
+TEST(MemoryControlTest, DynamicBlockGrowsGeometrically) {
+    NetworkMemoryControl networkMemoryControl;
+    auto memoryControl = networkMemoryControl.createMemoryControlUnit("test");
+    memoryControl->insert(MemoryRegions{dynamicRegion(0, 2, 0)}, {});
+    auto solution = memoryControl->solve();
+    memoryControl->allocateMemory();
+
+    auto block = solution.at(0);
+    ASSERT_TRUE(block->resize(1000));
+    ASSERT_TRUE(block->resize(1200));
+    const auto* ptr = block->getRawPtr();
+    // fits into the geometrically grown block
+    ASSERT_FALSE(block->resize(1400));
+    ASSERT_EQ(ptr, block->getRawPtr());
+    ASSERT_TRUE(block->resize(1600));
+
+    // the released block is reallocated to the requested size, so the release lowers the memory footprint
+    memoryControl->releaseMemory();
+    ASSERT_EQ(nullptr, block->getRawPtr());
+    ASSERT_TRUE(block->resize(10));
+    ASSERT_TRUE(block->resize(12));
+    ASSERT_FALSE(block->resize(15));
+}
+
+TEST(MemoryControlTest, IncrementalSolveKeepsPlacedRegions) {
+    NetworkMemoryControl networkMemoryControl;
+    auto memoryControl = networkMemoryControl.createMemoryControlUnit("test");
+    memoryControl->insert({dynamicRegion(0, 2, 0), dynamicRegion(1, 3, 1), dynamicRegion(3, -1, 2)}, {});
+    auto solution = memoryControl->solve();
+    memoryControl->allocateMemory();
+    ASSERT_TRUE(solution.at(0)->resize(256));
+    ASSERT_TRUE(solution.at(1)->resize(256));
+    // the regions 0 and 2 do not overlap, so they share the block
+    ASSERT_FALSE(solution.at(2)->resize(128));
+    ASSERT_EQ(solution.at(0)->getRawPtr(), solution.at(2)->getRawPtr());
+
+    memoryControl->insert(MemoryRegions{dynamicRegion(4, 5, 3)}, {});
+    auto newSolution = memoryControl->solve();
+    ASSERT_EQ(4u, newSolution.size());
+    for (int64_t id = 0; id < 3; id++) {
+        ASSERT_EQ(solution.at(id), newSolution.at(id));
+    }
+    // overlaps the region 2 only, so it is placed into the block of the region 1 and needs no allocation
+    ASSERT_FALSE(newSolution.at(3)->resize(256));
+    ASSERT_EQ(solution.at(1)->getRawPtr(), newSolution.at(3)->getRawPtr());
+}
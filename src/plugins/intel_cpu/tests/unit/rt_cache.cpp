@@ -9,6 +9,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
 #include "common_test_utils/test_assertions.hpp"
 
 using namespace ov::intel_cpu;
@@ -97,6 +98,62 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+namespace {
+// the shard is selected by the hash value, so keep it predictable
+struct IdentityKey {
+    size_t hash() const {
+        return static_cast<size_t>(data);
+    }
+    bool operator==(const IdentityKey& rhs) const noexcept {
+        return this->data == rhs.data;
+    }
+
+    int data;
+};
+
+// records of this key are stateless, so they may be stored in the cache shared by the streams
+struct StatelessKey : IdentityKey {};
+} // namespace
+
+template <>
+struct ov::intel_cpu::SharedBetweenStreams<StatelessKey> : std::true_type {};
+
+TEST(ShardedLruCacheTests, Get) {
+    constexpr int capacity = 16;
+    constexpr size_t shards = 4;
+    ShardedLruCache<IdentityKey, int> cache(capacity, shards);
+    ASSERT_EQ(cache.getNumShards(), shards);
+    for (int i = 1; i <= capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i <= capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(ShardedLruCacheTests, Statistics) {
+    constexpr int capacity = 4;
+    constexpr size_t shards = 2;
+    ShardedLruCache<IdentityKey, int> cache(capacity, shards);
+    // even keys go to the shard 0 and odd keys go to the shard 1
+    for (int i = 0; i < 2 * capacity; i += 2) {
+        cache.put({i}, i + 1);
+    }
+    ASSERT_EQ(cache.get({0}), int());
+    ASSERT_EQ(cache.get({6}), 7);
+    ASSERT_EQ(cache.get({1}), int());
+
+    auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.size(), shards);
+    ASSERT_EQ(stats[0].hits, 1U);
+    ASSERT_EQ(stats[0].misses, 1U);
+    ASSERT_EQ(stats[0].evictions, 2U);
+    ASSERT_EQ(stats[1].hits, 0U);
+    ASSERT_EQ(stats[1].misses, 1U);
+    ASSERT_EQ(stats[1].evictions, 0U);
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -380,3 +437,87 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, SharedBetweenThreads) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 64;
+    constexpr size_t shards = 8;
+    constexpr size_t numThreads = 16;
+
+    auto intBuilder = [&](const IdentityKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity, shards);
+    ASSERT_TRUE(cache.isThreadSafe());
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < capacity; ++i) {
+            auto intResult = cache.getOrCreate(IdentityKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    // all the records fit into the cache, so each key has been missed at least once and then only hit afterwards
+    for (int i = 0; i < capacity; ++i) {
+        auto intResult = cache.getOrCreate(IdentityKey{i}, intBuilder);
+        ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.size(), shards);
+    for (const auto& shard : stats) {
+        hits += shard.hits;
+        misses += shard.misses;
+        evictions += shard.evictions;
+    }
+    ASSERT_EQ(hits + misses, (numThreads + 1) * capacity);
+    ASSERT_GE(misses, static_cast<uint64_t>(capacity));
+    ASSERT_EQ(evictions, 0U);
+}
+
+TEST(MultiCacheTests, PerStreamCachesShareStatelessRecordsOnly) {
+    constexpr int capacity = 16;
+    constexpr size_t shards = 4;
+
+    auto sharedCache = std::make_shared<MultiCache>(capacity, shards);
+    MultiCache firstStreamCache(capacity, sharedCache);
+    MultiCache secondStreamCache(capacity, sharedCache);
+    ASSERT_FALSE(firstStreamCache.isThreadSafe());
+
+    auto statefulBuilder = [](const IdentityKey& key) { return std::make_shared<int>(key.data); };
+    auto statelessBuilder = [](const StatelessKey& key) { return std::make_shared<int>(key.data); };
+
+    for (int i = 0; i < capacity; ++i) {
+        auto first = firstStreamCache.getOrCreate(IdentityKey{i}, statefulBuilder);
+        auto second = secondStreamCache.getOrCreate(IdentityKey{i}, statefulBuilder);
+        ASSERT_EQ(first.second, CacheEntryBase::LookUpStatus::Miss);
+        ASSERT_EQ(second.second, CacheEntryBase::LookUpStatus::Miss);
+        ASSERT_NE(first.first, second.first);
+    }
+
+    for (int i = 0; i < capacity; ++i) {
+        auto first = firstStreamCache.getOrCreate(StatelessKey{{i}}, statelessBuilder);
+        auto second = secondStreamCache.getOrCreate(StatelessKey{{i}}, statelessBuilder);
+        ASSERT_EQ(first.second, CacheEntryBase::LookUpStatus::Miss);
+        ASSERT_EQ(second.second, CacheEntryBase::LookUpStatus::Hit);
+        ASSERT_EQ(first.first, second.first);
+    }
+
+    uint64_t lookups = 0;
+    for (const auto& shard : sharedCache->getStatistics()) {
+        lookups += shard.hits + shard.misses;
+    }
+    ASSERT_EQ(lookups, static_cast<uint64_t>(2 * capacity));
+}
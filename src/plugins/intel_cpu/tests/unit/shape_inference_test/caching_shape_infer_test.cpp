@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "common_test_utils/test_assertions.hpp"
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "shape_inference/shape_inference_caching.hpp"
+#include "shape_inference/shape_inference_status.hpp"
+
+using namespace ov::intel_cpu;
+using namespace testing;
+
+namespace {
+
+class MockShapeInfer : public IShapeInfer {
+public:
+    MOCK_METHOD(Result,
+                infer,
+                ((const std::vector<std::reference_wrapper<const VectorDims>>&),
+                 (const std::unordered_map<size_t, MemoryPtr>&)),
+                (override));
+    MOCK_METHOD(const ov::CoordinateDiff&, get_pads_begin, (), (override));
+    MOCK_METHOD(const ov::CoordinateDiff&, get_pads_end, (), (override));
+    MOCK_METHOD(port_mask_t, get_port_mask, (), (const, override));
+};
+
+using ShapeRefs = std::vector<std::reference_wrapper<const VectorDims>>;
+
+}  // namespace
+
+TEST(CachingShapeInferTest, SkipsRepeatedShapes) {
+    auto mock = std::make_shared<StrictMock<MockShapeInfer>>();
+    ov::CoordinateDiff padsBegin{1, 1};
+    ov::CoordinateDiff padsEnd{0, 2};
+    EXPECT_CALL(*mock, get_port_mask()).WillRepeatedly(Return(EMPTY_PORT_MASK));
+    EXPECT_CALL(*mock, get_pads_begin()).WillRepeatedly(ReturnRef(padsBegin));
+    EXPECT_CALL(*mock, get_pads_end()).WillRepeatedly(ReturnRef(padsEnd));
+    EXPECT_CALL(*mock, infer(_, _))
+        .Times(2)
+        .WillRepeatedly([](const ShapeRefs& shapes, const std::unordered_map<size_t, MemoryPtr>&) {
+            return IShapeInfer::Result{{shapes.front().get()}, ShapeInferStatus::success};
+        });
+
+    CachingShapeInfer cachingShapeInfer(mock, 4);
+
+    const VectorDims first{1, 3, 16, 16};
+    const VectorDims second{2, 3, 8, 8};
+    for (const auto& dims : {first, second, first, second, first}) {
+        auto result = cachingShapeInfer.infer(ShapeRefs{std::cref(dims)}, {});
+        ASSERT_EQ(result.status, ShapeInferStatus::success);
+        ASSERT_EQ(result.dims, std::vector<VectorDims>{dims});
+        ASSERT_EQ(cachingShapeInfer.get_pads_begin(), padsBegin);
+        ASSERT_EQ(cachingShapeInfer.get_pads_end(), padsEnd);
+    }
+}
+
+TEST(CachingShapeInferTest, KeysDataDependentInputsByValue) {
+    auto mock = std::make_shared<StrictMock<MockShapeInfer>>();
+    EXPECT_CALL(*mock, get_port_mask()).WillRepeatedly(Return(IShapeInfer::port_mask_t{1U << 1U}));
+    ov::CoordinateDiff pads;
+    EXPECT_CALL(*mock, get_pads_begin()).WillRepeatedly(ReturnRef(pads));
+    EXPECT_CALL(*mock, get_pads_end()).WillRepeatedly(ReturnRef(pads));
+    EXPECT_CALL(*mock, infer(_, _))
+        .Times(2)
+        .WillRepeatedly([](const ShapeRefs&, const std::unordered_map<size_t, MemoryPtr>& values) {
+            const auto* data = values.at(1)->getDataAs<const int32_t>();
+            return IShapeInfer::Result{{VectorDims{static_cast<size_t>(data[0]), static_cast<size_t>(data[1])}},
+                                       ShapeInferStatus::success};
+        });
+
+    CachingShapeInfer cachingShapeInfer(mock, 4);
+
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    CpuBlockedMemoryDesc desc(ov::element::i32, Shape(VectorDims{2}));
+    std::vector<int32_t> target{4, 5};
+    auto targetMem = std::make_shared<Memory>(eng, desc, target.data(), false);
+    const VectorDims dataDims{4, 5};
+    const VectorDims targetDims{2};
+    const ShapeRefs shapes{std::cref(dataDims), std::cref(targetDims)};
+
+    auto result = cachingShapeInfer.infer(shapes, {{1, targetMem}});
+    ASSERT_EQ(result.dims, std::vector<VectorDims>{VectorDims{4, 5}});
+    result = cachingShapeInfer.infer(shapes, {{1, targetMem}});
+    ASSERT_EQ(result.dims, std::vector<VectorDims>{VectorDims{4, 5}});
+
+    // same shapes, different values must not hit the cache
+    target = {6, 7};
+    result = cachingShapeInfer.infer(shapes, {{1, targetMem}});
+    ASSERT_EQ(result.dims, std::vector<VectorDims>{VectorDims{6, 7}});
+}
+
+TEST(CachingShapeInferTest, DoesNotCacheSkippedResults) {
+    auto mock = std::make_shared<StrictMock<MockShapeInfer>>();
+    EXPECT_CALL(*mock, get_port_mask()).WillRepeatedly(Return(EMPTY_PORT_MASK));
+    EXPECT_CALL(*mock, infer(_, _)).Times(3).WillRepeatedly(Return(IShapeInfer::Result{{}, ShapeInferStatus::skip}));
+
+    CachingShapeInfer cachingShapeInfer(mock, 4);
+
+    const VectorDims dims{1, 16};
+    for (size_t i = 0; i < 3; i++) {
+        auto result = cachingShapeInfer.infer(ShapeRefs{std::cref(dims)}, {});
+        ASSERT_EQ(result.status, ShapeInferStatus::skip);
+    }
+}
+
+TEST(CachingShapeInferTest, DoesNotCacheLargeDataDependentInputs) {
+    auto mock = std::make_shared<StrictMock<MockShapeInfer>>();
+    EXPECT_CALL(*mock, get_port_mask()).WillRepeatedly(Return(IShapeInfer::port_mask_t{1U << 1U}));
+    ov::CoordinateDiff pads;
+    EXPECT_CALL(*mock, get_pads_begin()).WillRepeatedly(ReturnRef(pads));
+    EXPECT_CALL(*mock, get_pads_end()).WillRepeatedly(ReturnRef(pads));
+    EXPECT_CALL(*mock, infer(_, _))
+        .Times(3)
+        .WillRepeatedly([](const ShapeRefs& shapes, const std::unordered_map<size_t, MemoryPtr>&) {
+            return IShapeInfer::Result{{shapes.front().get()}, ShapeInferStatus::success};
+        });
+
+    CachingShapeInfer cachingShapeInfer(mock, 4);
+
+    const size_t count = CachingShapeInfer::maxKeyValuesSize / sizeof(int32_t) + 1;
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    CpuBlockedMemoryDesc desc(ov::element::i32, Shape(VectorDims{count}));
+    std::vector<int32_t> values(count, 1);
+    auto valuesMem = std::make_shared<Memory>(eng, desc, values.data(), false);
+    const VectorDims dataDims{4, 5};
+    const VectorDims valuesDims{count};
+    const ShapeRefs shapes{std::cref(dataDims), std::cref(valuesDims)};
+
+    for (size_t i = 0; i < 3; i++) {
+        auto result = cachingShapeInfer.infer(shapes, {{1, valuesMem}});
+        ASSERT_EQ(result.dims, std::vector<VectorDims>{dataDims});
+    }
+}
@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/snippets/x64/pass/lowered/brgemm_blocking_tuner.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <tuple>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "onednn/dnnl.h"
+#include "openvino/core/except.hpp"
+
+using namespace ov::intel_cpu::pass;
+using namespace dnnl::impl::cpu;
+
+namespace {
+
+class BrgemmBlockingTunerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        db_path = ov::test::utils::generateTestFilePrefix() + "_brgemm_tuning.db";
+    }
+    void TearDown() override {
+        ov::test::utils::removeFile(db_path);
+    }
+
+    std::string db_path;
+    const BrgemmBlockingTuner::Shape shape{x64::avx512_core, ov::element::f32, 1024, 512, 768, 64};
+};
+
+}  // namespace
+
+TEST_F(BrgemmBlockingTunerTest, SelectsFastestCandidateAndStoresIt) {
+    size_t measured = 0;
+    BrgemmBlockingTuner tuner(db_path, [&](const BrgemmBlockingTuner::Shape&, const BrgemmBlockingTuner::Blocking& b) {
+        measured++;
+        return std::abs(static_cast<double>(std::get<0>(b)) - 64) +
+               std::abs(static_cast<double>(std::get<2>(b)) - 256);
+    });
+
+    const auto blocking = tuner.get_blocking(shape, {32, 64, 512});
+    ASSERT_EQ(BrgemmBlockingTuner::Blocking(64, 64, 256), blocking);
+    ASSERT_GT(measured, 1U);
+
+    // the tuned shape is not measured again
+    measured = 0;
+    ASSERT_EQ(blocking, tuner.get_blocking(shape, {32, 64, 512}));
+    ASSERT_EQ(0U, measured);
+
+    std::ifstream db(db_path);
+    std::string record;
+    ASSERT_TRUE(std::getline(db, record));
+    ASSERT_FALSE(std::getline(db, record));
+}
+
+TEST_F(BrgemmBlockingTunerTest, ReadsTunedBlockingFromDatabase) {
+    BrgemmBlockingTuner tuner(db_path, [](const BrgemmBlockingTuner::Shape&, const BrgemmBlockingTuner::Blocking& b) {
+        return static_cast<double>(std::get<0>(b));
+    });
+    const auto blocking = tuner.get_blocking(shape, {32, 64, 512});
+
+    BrgemmBlockingTuner next_tuner(db_path, [](const BrgemmBlockingTuner::Shape&, const BrgemmBlockingTuner::Blocking&) {
+        OPENVINO_THROW("The blocking stored in the database must not be measured");
+        return 0.0;
+    });
+    ASSERT_EQ(blocking, next_tuner.get_blocking(shape, {32, 64, 512}));
+}
+
+TEST_F(BrgemmBlockingTunerTest, SkipsMalformedRecords) {
+    {
+        std::ofstream db(db_path);
+        db << "corrupted record\n";
+    }
+    BrgemmBlockingTuner tuner(db_path, [](const BrgemmBlockingTuner::Shape&, const BrgemmBlockingTuner::Blocking& b) {
+        return static_cast<double>(std::get<2>(b));
+    });
+    ASSERT_EQ(BrgemmBlockingTuner::Blocking(16, 64, 128), tuner.get_blocking(shape, {32, 64, 512}));
+}
+
+TEST_F(BrgemmBlockingTunerTest, SeparatesWeightsLayoutsAndKeepsHeuristicNBlock) {
+    size_t measured = 0;
+    BrgemmBlockingTuner tuner(db_path, [&](const BrgemmBlockingTuner::Shape&, const BrgemmBlockingTuner::Blocking& b) {
+        measured++;
+        return static_cast<double>(std::get<0>(b));
+    });
+    ASSERT_EQ(BrgemmBlockingTuner::Blocking(16, 64, 128), tuner.get_blocking(shape, {32, 64, 512}));
+
+    // the same dimensions with the planar weights are tuned separately, with their own N block
+    auto planar_shape = shape;
+    planar_shape.wei_n_blk = 0;
+    measured = 0;
+    ASSERT_EQ(BrgemmBlockingTuner::Blocking(16, 512, 128), tuner.get_blocking(planar_shape, {32, 512, 512}));
+    ASSERT_GT(measured, 0U);
+
+    // the N block of the stored record is never returned instead of the heuristic one
+    BrgemmBlockingTuner next_tuner(db_path, [](const BrgemmBlockingTuner::Shape&, const BrgemmBlockingTuner::Blocking&) {
+        OPENVINO_THROW("The blocking stored in the database must not be measured");
+        return 0.0;
+    });
+    ASSERT_EQ(BrgemmBlockingTuner::Blocking(16, 48, 128), next_tuner.get_blocking(shape, {32, 48, 512}));
+}
+
+TEST_F(BrgemmBlockingTunerTest, SkipsRecordsWithoutWeightsLayout) {
+    {
+        std::ofstream db(db_path);
+        db << static_cast<unsigned>(x64::avx512_core) << " " << dnnl::utils::get_cache_size(2, true)
+           << " f32 1024 512 768 128 64 1024\n";
+    }
+    size_t measured = 0;
+    BrgemmBlockingTuner tuner(db_path, [&](const BrgemmBlockingTuner::Shape&, const BrgemmBlockingTuner::Blocking& b) {
+        measured++;
+        return static_cast<double>(std::get<0>(b));
+    });
+    ASSERT_EQ(BrgemmBlockingTuner::Blocking(16, 64, 128), tuner.get_blocking(shape, {32, 64, 512}));
+    ASSERT_GT(measured, 0U);
+}
@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "shared_test_classes/base/snippets_test_utils.hpp"
+#include "subgraph_mvn.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+typedef std::tuple<
+        std::vector<InputShape>,         // Input Shapes: the second one is the residual input
+        MVNFunction::PostOp,             // The last op of the chain
+        size_t,                          // Expected num nodes
+        size_t,                          // Expected num subgraphs
+        std::string                      // Target Device
+> MVNParams;
+
+class MVN : public testing::WithParamInterface<ov::test::snippets::MVNParams>,
+            virtual public SnippetsTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ov::test::snippets::MVNParams>& obj);
+
+protected:
+    void SetUp() override;
+};
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
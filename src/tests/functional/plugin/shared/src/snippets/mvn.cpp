@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/common_utils.hpp"
+#include "snippets/mvn.hpp"
+#include "subgraph_mvn.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::string MVN::getTestCaseName(const testing::TestParamInfo<ov::test::snippets::MVNParams>& obj) {
+    const auto& [inputShapes, postOp, num_nodes, num_subgraphs, targetDevice] = obj.param;
+
+    std::ostringstream result;
+    for (size_t i = 0; i < inputShapes.size(); i++) {
+        result << "IS[" << i << "]=" << ov::test::utils::partialShape2str({inputShapes[i].first}) << "_";
+        result << "TS[" << i << "]=";
+        for (const auto& shape : inputShapes[i].second) {
+            result << "(" << ov::test::utils::vec2str(shape) << ")_";
+        }
+    }
+    result << "PostOp=" << postOp << "_";
+    result << "#N=" << num_nodes << "_";
+    result << "#S=" << num_subgraphs << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void MVN::SetUp() {
+    const auto& [inputShapes, postOp, _ref_num_nodes, _ref_num_subgraphs, _targetDevice] = this->GetParam();
+    ref_num_nodes = _ref_num_nodes;
+    ref_num_subgraphs = _ref_num_subgraphs;
+    targetDevice = _targetDevice;
+
+    init_input_shapes(inputShapes);
+
+    auto f = ov::test::snippets::MVNFunction(inputDynamicShapes, postOp);
+    function = f.getOriginal();
+
+    // the fused chain is computed in f32
+    setInferenceType(ov::element::f32);
+    setIgnoreCallbackMode();
+
+    // the quantized values may differ by one level if the normalized value is close to the rounding boundary
+    abs_threshold = postOp == MVNFunction::PostOp::None ? 1e-4 : 1;
+}
+
+TEST_P(MVN, CompareWithRefImpl) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    validateNumSubgraphs();
+}
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "snippets_helpers.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+/* Graph:
+ *   Parameter   [Parameter]
+ *        \      /
+ *        [Add (residual)]
+ *              |
+ *         MVN (last dim)
+ *              |
+ *       Multiply   Constant[C]
+ *              |  /
+ *             Add   Constant[C]
+ *              |
+ *  [FakeQuantize or Convert]
+ *              |
+ *            Result
+ * The residual Add is inserted if 2 input shapes are passed.
+ */
+class MVNFunction : public SnippetsFunctionBase {
+public:
+    enum class PostOp {
+        None,
+        FakeQuantize,
+        Convert,  //!< to i8
+    };
+
+    explicit MVNFunction(const std::vector<PartialShape>& inputShapes, PostOp post_op)
+        : SnippetsFunctionBase(inputShapes), post_op(post_op) {
+        OPENVINO_ASSERT(input_shapes.size() == 1 || input_shapes.size() == 2, "Got invalid number of input shapes");
+        OPENVINO_ASSERT(input_shapes[0].is_static(), "MVNFunction supports only static shapes");
+    }
+
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+    std::shared_ptr<ov::Model> initReference() const override;
+
+private:
+    // Builds the normalization chain on the data inputs with the scale and shift inputs
+    std::shared_ptr<ov::Node> make_chain(const ov::OutputVector& data, const ov::OutputVector& affine) const;
+    ov::OutputVector make_affine_constants() const;
+
+    PostOp post_op;
+};
+
+std::ostream& operator<<(std::ostream& os, MVNFunction::PostOp post_op);
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_mvn.hpp"
+
+#include "openvino/op/mvn.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "snippets/op/result.hpp"
+#include "snippets/op/subgraph.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::ostream& operator<<(std::ostream& os, MVNFunction::PostOp post_op) {
+    switch (post_op) {
+    case MVNFunction::PostOp::None:
+        os << "None";
+        break;
+    case MVNFunction::PostOp::FakeQuantize:
+        os << "FakeQuantize";
+        break;
+    case MVNFunction::PostOp::Convert:
+        os << "Convert";
+        break;
+    default:
+        OPENVINO_THROW("Unexpected MVN post-op!");
+    }
+    return os;
+}
+
+ov::OutputVector MVNFunction::make_affine_constants() const {
+    const auto features = static_cast<size_t>(input_shapes[0].rbegin()->get_length());
+    const auto scale = op::v0::Constant::create(precision, Shape{features}, std::vector<float>(features, 1.5f));
+    const auto shift = op::v0::Constant::create(precision, Shape{features}, std::vector<float>(features, 0.5f));
+    return {scale, shift};
+}
+
+std::shared_ptr<ov::Node> MVNFunction::make_chain(const ov::OutputVector& data, const ov::OutputVector& affine) const {
+    ov::Output<ov::Node> parent = data[0];
+    if (data.size() == 2) {
+        parent = std::make_shared<op::v1::Add>(data[0], data[1]);
+    }
+    const auto axes = op::v0::Constant::create(element::i64, Shape{1}, {-1});
+    const auto mvn = std::make_shared<op::v6::MVN>(parent, axes, true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+    const auto scale = std::make_shared<op::v1::Multiply>(mvn, affine[0]);
+    std::shared_ptr<ov::Node> last = std::make_shared<op::v1::Add>(scale, affine[1]);
+    if (post_op == PostOp::FakeQuantize) {
+        const auto il = op::v0::Constant::create(precision, Shape{}, {-5.f});
+        const auto ih = op::v0::Constant::create(precision, Shape{}, {5.f});
+        const auto ol = op::v0::Constant::create(precision, Shape{}, {-128.f});
+        const auto oh = op::v0::Constant::create(precision, Shape{}, {127.f});
+        last = std::make_shared<op::v0::FakeQuantize>(last, il, ih, ol, oh, 256);
+    } else if (post_op == PostOp::Convert) {
+        last = std::make_shared<op::v0::Convert>(last, element::i8);
+    }
+    return last;
+}
+
+std::shared_ptr<ov::Model> MVNFunction::initOriginal() const {
+    ParameterVector params;
+    OutputVector data;
+    for (const auto& shape : input_shapes) {
+        params.push_back(std::make_shared<op::v0::Parameter>(precision, shape));
+        data.push_back(params.back());
+    }
+    const auto chain = make_chain(data, make_affine_constants());
+    return std::make_shared<ov::Model>(OutputVector{chain}, params);
+}
+
+std::shared_ptr<ov::Model> MVNFunction::initReference() const {
+    ParameterVector params;
+    OutputVector subgraph_inputs;
+    ParameterVector body_params;
+    OutputVector body_data;
+    for (const auto& shape : input_shapes) {
+        params.push_back(std::make_shared<op::v0::Parameter>(precision, shape));
+        subgraph_inputs.push_back(params.back());
+        body_params.push_back(std::make_shared<op::v0::Parameter>(precision, shape));
+        body_data.push_back(body_params.back());
+    }
+    // The affine constants are not scalar, so they are passed to the Subgraph as inputs
+    OutputVector body_affine;
+    for (const auto& constant : make_affine_constants()) {
+        subgraph_inputs.push_back(constant);
+        body_params.push_back(std::make_shared<op::v0::Parameter>(precision, constant.get_partial_shape()));
+        body_affine.push_back(body_params.back());
+    }
+    const auto chain = make_chain(body_data, body_affine);
+    const auto body = std::make_shared<ov::Model>(
+        OutputVector{std::make_shared<ov::snippets::op::Result>(chain)}, body_params);
+    const auto subgraph = std::make_shared<ov::snippets::op::Subgraph>(subgraph_inputs, body);
+    return std::make_shared<ov::Model>(OutputVector{subgraph}, params);
+}
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov